@@ -18,15 +18,34 @@ copy_to   = "/sphenix/user/danderson/sphenix/analysis/AndersonAnalysisModules/Co
 # what files to copy
 to_copy = [
   "README.md",
+  "src/AlignedAllocator.h",
+  "src/CaloGrid.cc",
+  "src/CaloGrid.h",
   "src/ClustInfo.cc",
   "src/ClustInfo.h",
+  "src/ClustInfoSoA.cc",
+  "src/ClustInfoSoA.h",
   "src/ClustInterfaces.cc",
   "src/ClustInterfaces.h",
   "src/ClustTools.cc",
   "src/ClustTools.h",
+  "src/ConcurrentHist.cc",
+  "src/ConcurrentHist.h",
   "src/Constants.h",
+  "src/CorrHist.cc",
+  "src/CorrHist.h",
+  "src/CorrTools.cc",
+  "src/CorrTools.h",
   "src/CstInfo.cc",
   "src/CstInfo.h",
+  "src/CstInfoSoA.cc",
+  "src/CstInfoSoA.h",
+  "src/CutSet.cc",
+  "src/CutSet.h",
+  "src/E3CEngine.cc",
+  "src/E3CEngine.h",
+  "src/EtaPhiIndex.cc",
+  "src/EtaPhiIndex.h",
   "src/FlowInfo.cc",
   "src/FlowInfo.h",
   "src/FlowInterfaces.cc",
@@ -38,8 +57,15 @@ to_copy = [
   "src/Interfaces.h",
   "src/JetInfo.cc",
   "src/JetInfo.h",
+  "src/JetTools.cc",
+  "src/JetTools.h",
+  "src/MemberLayout.h",
+  "src/NodeCache.cc",
+  "src/NodeCache.h",
   "src/NodeInterfaces.cc",
   "src/NodeInterfaces.h",
+  "src/ParallelTreeProcessor.cc",
+  "src/ParallelTreeProcessor.h",
   "src/ParInfo.cc",
   "src/ParInfo.h",
   "src/ParInterfaces.cc",
@@ -50,6 +76,8 @@ to_copy = [
   "src/RecoInfo.h",
   "src/RecoTools.cc",
   "src/RecoTools.h",
+  "src/SparseHist.cc",
+  "src/SparseHist.h",
   "src/TreeInterfaces.cc",
   "src/TreeInterfaces.h",
   "src/TrkInfo.cc",
@@ -59,6 +87,10 @@ to_copy = [
   "src/TrkTools.cc",
   "src/TrkTools.h",
   "src/Tools.h",
+  "src/TrkInfoSoA.cc",
+  "src/TrkInfoSoA.h",
+  "src/TrkMatchInfo.cc",
+  "src/TrkMatchInfo.h",
   "src/Types.h",
   "src/TypesLinkDef.h",
   "src/TupleInterfaces.cc",
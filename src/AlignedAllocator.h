@@ -0,0 +1,69 @@
+// ----------------------------------------------------------------------------
+// 'AlignedAllocator.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Allocator for cache-line aligned columns used by the
+// structure-of-arrays utility types.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_ALIGNEDALLOCATOR_H
+#define SCORRELATORUTILITIES_ALIGNEDALLOCATOR_H
+
+// c++ utilities
+#include <new>
+#include <vector>
+#include <cstddef>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // AlignedAllocator definition --------------------------------------------
+
+    template <typename T, size_t Align = 64> struct AlignedAllocator {
+
+      typedef T value_type;
+
+      template <typename U> struct rebind {
+        typedef AlignedAllocator<U, Align> other;
+      };
+
+      T* allocate(const size_t size) {
+        return static_cast<T*>(::operator new(size * sizeof(T), align_val_t(Align)));
+      }
+
+      void deallocate(T* pointer, const size_t) noexcept {
+        ::operator delete(pointer, align_val_t(Align));
+      }
+
+      // ctors
+      AlignedAllocator() noexcept {}
+      template <typename U> AlignedAllocator(const AlignedAllocator<U, Align>&) noexcept {}
+
+    };  // end AlignedAllocator definition
+
+
+
+    // all aligned allocators are interchangeable
+    template <typename T, typename U, size_t Align>
+    bool operator ==(const AlignedAllocator<T, Align>&, const AlignedAllocator<U, Align>&) {return true;}
+
+    template <typename T, typename U, size_t Align>
+    bool operator !=(const AlignedAllocator<T, Align>&, const AlignedAllocator<U, Align>&) {return false;}
+
+
+
+    // cache-line aligned column
+    template <typename T> using AlignedVector = vector<T, AlignedAllocator<T, 64>>;
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,277 @@
+// ----------------------------------------------------------------------------
+// 'CaloGrid.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Dense eta-phi grid of calorimeter energy, summed over
+// the EMCal, IHCal and OHCal, for jet inputs and matching.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CALOGRID_CC
+
+// class definition
+#include "CaloGrid.h"
+
+// c++ utilities
+#include <algorithm>
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // internal methods ---------------------------------------------------------
+
+  void Types::CaloGrid::AddToCell(const size_t cell, const double ene, const int sys) {
+
+    // track first touch so reset and readout only visit active cells
+    if (!cellActive[cell]) {
+      cellActive[cell] = 1;
+      active.push_back(cell);
+    }
+    cellEne[cell] += ene;
+    if ((sys >= 0) && (sys < 8)) {
+      cellSys[cell] |= (uint8_t) (1 << sys);
+    }
+    return;
+
+  }  // end 'AddToCell(size_t, double, int)'
+
+
+
+  // cell accessors -----------------------------------------------------------
+
+  double Types::CaloGrid::GetCellEta(const size_t cell) const {
+
+    const double width = (etaAxis.GetMax() - etaAxis.GetMin()) / (double) nEta;
+    return etaAxis.GetMin() + ((GetEtaIndex(cell) + 0.5) * width);
+
+  }  // end 'GetCellEta(size_t)'
+
+
+
+  double Types::CaloGrid::GetCellPhi(const size_t cell) const {
+
+    const double width = (phiAxis.GetMax() - phiAxis.GetMin()) / (double) nPhi;
+    return phiAxis.GetMin() + ((GetPhiIndex(cell) + 0.5) * width);
+
+  }  // end 'GetCellPhi(size_t)'
+
+
+
+  size_t Types::CaloGrid::FindCell(const double eta, const double phi) const {
+
+    // n.b. axis bins are 1-indexed with under/overflow at 0 and n + 1
+    const size_t etaBin = etaAxis.FindBin(eta);
+    if ((etaBin == 0) || (etaBin > nEta)) return NoCell;
+
+    // wrap phi into [-pi, pi)
+    double phiWrap = fmod(phi + M_PI, 2. * M_PI);
+    if (phiWrap < 0.) phiWrap += 2. * M_PI;
+    phiWrap -= M_PI;
+
+    const size_t phiBin = clamp(phiAxis.FindBin(phiWrap), (size_t) 1, nPhi);
+    return GetCell(etaBin - 1, phiBin - 1);
+
+  }  // end 'FindCell(double, double)'
+
+
+
+  // public methods -----------------------------------------------------------
+
+  void Types::CaloGrid::Set(const size_t arg_nEta, const double etaMin, const double etaMax, const size_t arg_nPhi) {
+
+    // make sure grid is sensible
+    if ((arg_nEta == 0) || (arg_nPhi == 0) || (etaMax <= etaMin)) {
+      cerr << PHWHERE << "PANIC: trying to set calo grid with bad parameters! nEta = " << arg_nEta << ", nPhi = " << arg_nPhi << ", eta range = (" << etaMin << ", " << etaMax << ")" << endl;
+      assert((arg_nEta > 0) && (arg_nPhi > 0) && (etaMax > etaMin));
+    }
+
+    nEta = arg_nEta;
+    nPhi = arg_nPhi;
+    etaAxis.Set(nEta, etaMin, etaMax);
+    phiAxis.Set(nPhi, -M_PI, M_PI);
+
+    cellEne.assign(nEta * nPhi, 0.);
+    cellSys.assign(nEta * nPhi, 0);
+    cellActive.assign(nEta * nPhi, 0);
+    active.clear();
+    return;
+
+  }  // end 'Set(size_t, double, double, size_t)'
+
+
+
+  void Types::CaloGrid::Reset() {
+
+    // only active cells need zeroing
+    for (const size_t cell : active) {
+      cellEne[cell]    = 0.;
+      cellSys[cell]    = 0;
+      cellActive[cell] = 0;
+    }
+    active.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Types::CaloGrid::Add(const double eta, const double phi, const double ene, const int sys) {
+
+    const size_t cell = FindCell(eta, phi);
+    if (cell == NoCell) return;
+
+    AddToCell(cell, ene, sys);
+    return;
+
+  }  // end 'Add(double, double, double, int)'
+
+
+
+  void Types::CaloGrid::Fill(RawClusterContainer* store, const int sys, optional<ROOT::Math::XYZVector> vtx) {
+
+    // if no vertex provided, use origin
+    ROOT::Math::XYZVector vtxToUse(0., 0., 0.);
+    if (vtx.has_value()) {
+      vtxToUse = vtx.value();
+    }
+
+    // n.b. direction of the cluster momentum is that of its
+    // displacement from the vertex (cf. 'Tools::GetClustMomentum(...)')
+    RawClusterContainer::ConstRange clusters = store -> getClusters();
+    for (
+      RawClusterContainer::ConstIterator itClust = clusters.first;
+      itClust != clusters.second;
+      ++itClust
+    ) {
+      const RawCluster* clust = itClust -> second;
+      const double      dx    = clust -> get_position().x() - vtxToUse.X();
+      const double      dy    = clust -> get_position().y() - vtxToUse.Y();
+      const double      dz    = clust -> get_position().z() - vtxToUse.Z();
+      Add(asinh(dz / hypot(dx, dy)), atan2(dy, dx), clust -> get_energy(), sys);
+    }  // end cluster loop
+    return;
+
+  }  // end 'Fill(RawClusterContainer*, int, optional<ROOT::Math::XYZVector>)'
+
+
+
+  void Types::CaloGrid::Fill(const vector<ClustInfo>& clusts) {
+
+    for (const ClustInfo& clust : clusts) {
+      Add(clust.GetEta(), clust.GetPhi(), clust.GetEne(), clust.GetSystem());
+    }
+    return;
+
+  }  // end 'Fill(vector<ClustInfo>&)'
+
+
+
+  void Types::CaloGrid::Fill(const ClustInfoSoA& clusts) {
+
+    for (size_t iClust = 0; iClust < clusts.Size(); ++iClust) {
+      Add(clusts.eta[iClust], clusts.phi[iClust], clusts.ene[iClust], clusts.system[iClust]);
+    }
+    return;
+
+  }  // end 'Fill(ClustInfoSoA&)'
+
+
+
+  vector<fastjet::PseudoJet> Types::CaloGrid::GetPseudoJets(const double eneMin) const {
+
+    vector<fastjet::PseudoJet> pseudojets;
+    pseudojets.reserve(active.size());
+    for (const size_t cell : active) {
+
+      // skip cells below threshold
+      const double ene = cellEne[cell];
+      if (ene <= eneMin) continue;
+
+      // massless four-vector at cell center
+      const double eta = GetCellEta(cell);
+      const double phi = GetCellPhi(cell);
+      const double pt  = ene / cosh(eta);
+
+      fastjet::PseudoJet pseudojet(pt * cos(phi), pt * sin(phi), ene * tanh(eta), ene);
+      pseudojet.set_user_index((int) cell);
+      pseudojets.push_back(pseudojet);
+    }
+    return pseudojets;
+
+  }  // end 'GetPseudoJets(double)'
+
+
+
+  void Types::CaloGrid::GetNeighbors(const size_t cell, const size_t nCells, vector<size_t>& neighbors) const {
+
+    neighbors.clear();
+
+    // clamp window in eta, wrap in phi
+    const size_t iEta   = GetEtaIndex(cell);
+    const size_t iPhi   = GetPhiIndex(cell);
+    const size_t etaLo  = (iEta > nCells) ? (iEta - nCells) : 0;
+    const size_t etaHi  = min(iEta + nCells, nEta - 1);
+    const size_t phiWin = min((2 * nCells) + 1, nPhi);
+    const size_t phiLo  = (iPhi + nPhi - (min(nCells, nPhi) % nPhi)) % nPhi;
+
+    for (size_t jEta = etaLo; jEta <= etaHi; ++jEta) {
+      for (size_t dPhi = 0; dPhi < phiWin; ++dPhi) {
+        const size_t other = GetCell(jEta, (phiLo + dPhi) % nPhi);
+        if (other != cell) {
+          neighbors.push_back(other);
+        }
+      }
+    }
+    return;
+
+  }  // end 'GetNeighbors(size_t, size_t, vector<size_t>&)'
+
+
+
+  double Types::CaloGrid::GetNeighborhoodEne(const size_t cell, const size_t nCells) const {
+
+    // n.b. includes the central cell
+    thread_local vector<size_t> neighbors;
+    GetNeighbors(cell, nCells, neighbors);
+
+    double sum = cellEne[cell];
+    for (const size_t other : neighbors) {
+      sum += cellEne[other];
+    }
+    return sum;
+
+  }  // end 'GetNeighborhoodEne(size_t, size_t)'
+
+
+
+  // ctor/dtor ----------------------------------------------------------------
+
+  Types::CaloGrid::CaloGrid() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::CaloGrid::~CaloGrid() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::CaloGrid::CaloGrid(const size_t arg_nEta, const double etaMin, const double etaMax, const size_t arg_nPhi) {
+
+    Set(arg_nEta, etaMin, etaMax, arg_nPhi);
+
+  }  // end ctor(size_t, double, double, size_t)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
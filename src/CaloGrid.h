@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// 'CaloGrid.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Dense eta-phi grid of calorimeter energy, summed over
+// the EMCal, IHCal and OHCal, for jet inputs and matching.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CALOGRID_H
+#define SCORRELATORUTILITIES_CALOGRID_H
+
+// c++ utilities
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <optional>
+// root libraries
+#include <Math/Vector3D.h>
+// fastjet libraries
+#include <fastjet/PseudoJet.hh>
+// CaloBase libraries
+#include <calobase/RawCluster.h>
+#include <calobase/RawClusterContainer.h>
+// analysis utilities
+#include "CorrHist.h"
+#include "ClustInfo.h"
+#include "Constants.h"
+#include "ClustInfoSoA.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // CaloGrid definition ----------------------------------------------------
+
+    class CaloGrid {
+
+      private:
+
+        // binning: n.b. phi always covers [-pi, pi) and wraps
+        LinAxis etaAxis;
+        LinAxis phiAxis;
+        size_t  nEta = 0;
+        size_t  nPhi = 0;
+
+        // per-cell energy, mask of contributing subsystems, and
+        // whether the cell has been filled since the last reset
+        vector<double>  cellEne;
+        vector<uint8_t> cellSys;
+        vector<uint8_t> cellActive;
+
+        // cells with any energy, in order of first fill
+        vector<size_t> active;
+
+        // internal methods
+        void AddToCell(const size_t cell, const double ene, const int sys);
+
+      public:
+
+        // n.b. returned for positions outside the eta range
+        static constexpr size_t NoCell = numeric_limits<size_t>::max();
+
+        // getters
+        size_t                GetNEta()    const {return nEta;}
+        size_t                GetNPhi()    const {return nPhi;}
+        size_t                GetNCells()  const {return cellEne.size();}
+        const vector<size_t>& GetActive()  const {return active;}
+        const vector<double>& GetCellEne() const {return cellEne;}
+
+        // cell accessors
+        size_t  GetCell(const size_t iEta, const size_t iPhi) const {return (iEta * nPhi) + iPhi;}
+        size_t  GetEtaIndex(const size_t cell) const {return cell / nPhi;}
+        size_t  GetPhiIndex(const size_t cell) const {return cell % nPhi;}
+        double  GetCellEne(const size_t cell)  const {return cellEne[cell];}
+        uint8_t GetCellSys(const size_t cell)  const {return cellSys[cell];}
+        double  GetCellEta(const size_t cell)  const;
+        double  GetCellPhi(const size_t cell)  const;
+        size_t  FindCell(const double eta, const double phi) const;
+
+        // public methods
+        void Set(const size_t arg_nEta, const double etaMin, const double etaMax, const size_t arg_nPhi);
+        void Reset();
+        void Add(const double eta, const double phi, const double ene, const int sys = Const::Subsys::EMCal);
+        void Fill(RawClusterContainer* store, const int sys, optional<ROOT::Math::XYZVector> vtx = nullopt);
+        void Fill(const vector<ClustInfo>& clusts);
+        void Fill(const ClustInfoSoA& clusts);
+
+        // jet inputs: one massless pseudojet per active cell above
+        // threshold, pointing at the cell center, with the cell index
+        // as user index
+        vector<fastjet::PseudoJet> GetPseudoJets(const double eneMin = 0.) const;
+
+        // neighborhood queries: n.b. cost depends only on the window size
+        void   GetNeighbors(const size_t cell, const size_t nCells, vector<size_t>& neighbors) const;
+        double GetNeighborhoodEne(const size_t cell, const size_t nCells) const;
+
+        // default ctor/dtor
+        CaloGrid();
+        ~CaloGrid();
+
+        // ctor accepting arguments
+        CaloGrid(const size_t arg_nEta, const double etaMin, const double etaMax, const size_t arg_nPhi);
+
+    };  // end CaloGrid definition
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
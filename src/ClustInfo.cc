@@ -155,6 +155,30 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  vector<Types::MemberLayout> Types::ClustInfo::GetMemberLayout() {
+
+    // n.b. same order and names as GetListOfMembers()
+    vector<MemberLayout> layout = {
+      {"sys",  offsetof(ClustInfo, system), Const::Leaf::Int},
+      {"id",   offsetof(ClustInfo, id),     Const::Leaf::Int},
+      {"nTwr", offsetof(ClustInfo, nTwr),   Const::Leaf::Int64},
+      {"ene",  offsetof(ClustInfo, ene),    Const::Leaf::Double},
+      {"rho",  offsetof(ClustInfo, rho),    Const::Leaf::Double},
+      {"eta",  offsetof(ClustInfo, eta),    Const::Leaf::Double},
+      {"phi",  offsetof(ClustInfo, phi),    Const::Leaf::Double},
+      {"px",   offsetof(ClustInfo, px),     Const::Leaf::Double},
+      {"py",   offsetof(ClustInfo, py),     Const::Leaf::Double},
+      {"pz",   offsetof(ClustInfo, pz),     Const::Leaf::Double},
+      {"rx",   offsetof(ClustInfo, rx),     Const::Leaf::Double},
+      {"ry",   offsetof(ClustInfo, ry),     Const::Leaf::Double},
+      {"rz",   offsetof(ClustInfo, rz),     Const::Leaf::Double}
+    };
+    return layout;
+
+  }  // end 'GetMemberLayout()'
+
+
+
   // overloaded operators -----------------------------------------------------
 
   bool Types::operator <(const ClustInfo& lhs, const ClustInfo& rhs) {
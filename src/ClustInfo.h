@@ -24,6 +24,7 @@
 #include <calobase/RawCluster.h>
 // analysis utilities
 #include "Constants.h"
+#include "MemberLayout.h"
 #include "ClustTools.h"
 
 // make common namespaces implicit
@@ -98,7 +99,8 @@ namespace SColdQcdCorrelatorAnalysis {
         bool IsInAcceptance(const pair<ClustInfo, ClustInfo>& range) const;
 
         // static methods
-        static vector<string> GetListOfMembers();
+        static vector<string>       GetListOfMembers();
+        static vector<MemberLayout> GetMemberLayout();
 
         // overloaded operators
         friend bool operator <(const ClustInfo& lhs, const ClustInfo& rhs);
@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// 'ClustInfoSoA.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Structure-of-arrays container for calorimeter cluster
+// info, with one contiguous column per ClustInfo member.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CLUSTINFOSOA_CC
+
+// class definition
+#include "ClustInfoSoA.h"
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // container methods --------------------------------------------------------
+
+  void Types::ClustInfoSoA::Clear() {
+
+    // n.b. clear() keeps capacity, so refilling doesn't reallocate
+    system.clear();
+    id.clear();
+    nTwr.clear();
+    ene.clear();
+    rho.clear();
+    eta.clear();
+    phi.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    rx.clear();
+    ry.clear();
+    rz.clear();
+    et.clear();
+    stores.clear();
+    return;
+
+  }  // end 'Clear()'
+
+
+
+  void Types::ClustInfoSoA::Reserve(const size_t size) {
+
+    system.reserve(size);
+    id.reserve(size);
+    nTwr.reserve(size);
+    ene.reserve(size);
+    rho.reserve(size);
+    eta.reserve(size);
+    phi.reserve(size);
+    px.reserve(size);
+    py.reserve(size);
+    pz.reserve(size);
+    rx.reserve(size);
+    ry.reserve(size);
+    rz.reserve(size);
+    et.reserve(size);
+    return;
+
+  }  // end 'Reserve(size_t)'
+
+
+
+  void Types::ClustInfoSoA::Resize(const size_t size) {
+
+    system.resize(size);
+    id.resize(size);
+    nTwr.resize(size);
+    ene.resize(size);
+    rho.resize(size);
+    eta.resize(size);
+    phi.resize(size);
+    px.resize(size);
+    py.resize(size);
+    pz.resize(size);
+    rx.resize(size);
+    ry.resize(size);
+    rz.resize(size);
+    et.resize(size);
+    return;
+
+  }  // end 'Resize(size_t)'
+
+
+
+  void Types::ClustInfoSoA::Push(const ClustInfo& info) {
+
+    // n.b. ClustInfo doesn't carry et, so derive it from the momentum
+    const double pt = hypot(info.GetPX(), info.GetPY());
+    const double p  = sqrt((pt * pt) + (info.GetPZ() * info.GetPZ()));
+
+    system.push_back(info.GetSystem());
+    id    .push_back(info.GetID());
+    nTwr  .push_back(info.GetNTwr());
+    ene   .push_back(info.GetEne());
+    rho   .push_back(info.GetRho());
+    eta   .push_back(info.GetEta());
+    phi   .push_back(info.GetPhi());
+    px    .push_back(info.GetPX());
+    py    .push_back(info.GetPY());
+    pz    .push_back(info.GetPZ());
+    rx    .push_back(info.GetRX());
+    ry    .push_back(info.GetRY());
+    rz    .push_back(info.GetRZ());
+    et    .push_back((p > 0.) ? info.GetEne() * (pt / p) : 0.);
+    return;
+
+  }  // end 'Push(ClustInfo&)'
+
+
+
+  void Types::ClustInfoSoA::Fill(const vector<ClustInfo>& infos) {
+
+    Clear();
+    Reserve(infos.size());
+    for (const ClustInfo& info : infos) {
+      Push(info);
+    }
+    return;
+
+  }  // end 'Fill(vector<ClustInfo>&)'
+
+
+
+  Types::ClustInfo Types::ClustInfoSoA::GetInfo(const size_t index) const {
+
+    ClustInfo info;
+    info.SetSystem(system[index]);
+    info.SetID(id[index]);
+    info.SetNTwr(nTwr[index]);
+    info.SetEne(ene[index]);
+    info.SetRho(rho[index]);
+    info.SetEta(eta[index]);
+    info.SetPhi(phi[index]);
+    info.SetPX(px[index]);
+    info.SetPY(py[index]);
+    info.SetPZ(pz[index]);
+    info.SetRX(rx[index]);
+    info.SetRY(ry[index]);
+    info.SetRZ(rz[index]);
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  // ctor/dtor ----------------------------------------------------------------
+
+  Types::ClustInfoSoA::ClustInfoSoA() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::ClustInfoSoA::~ClustInfoSoA() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::ClustInfoSoA::ClustInfoSoA(const vector<ClustInfo>& infos) {
+
+    Fill(infos);
+
+  }  // end ctor(vector<ClustInfo>&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
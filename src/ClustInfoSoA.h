@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// 'ClustInfoSoA.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Structure-of-arrays container for calorimeter cluster
+// info, with one contiguous column per ClustInfo member.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CLUSTINFOSOA_H
+#define SCORRELATORUTILITIES_CLUSTINFOSOA_H
+
+// c++ utilities
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+// analysis utilities
+#include "ClustInfo.h"
+#include "Constants.h"
+#include "AlignedAllocator.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ClustInfoSoA definition ------------------------------------------------
+
+    struct ClustInfoSoA {
+
+      // [begin, end) range of the clusters from one store
+      struct StoreRange {
+        int    system = numeric_limits<int>::max();
+        size_t begin  = 0;
+        size_t end    = 0;
+        size_t Size() const {return end - begin;}
+      };
+
+      // proxy view of a single row
+      class Row {
+
+        private:
+
+          // data members
+          const ClustInfoSoA* soa   = NULL;
+          size_t              index = 0;
+
+        public:
+
+          // getters
+          int     GetSystem() const {return soa -> system[index];}
+          int     GetID() const     {return soa -> id[index];}
+          int64_t GetNTwr() const   {return soa -> nTwr[index];}
+          double  GetEne() const    {return soa -> ene[index];}
+          double  GetRho() const    {return soa -> rho[index];}
+          double  GetEta() const    {return soa -> eta[index];}
+          double  GetPhi() const    {return soa -> phi[index];}
+          double  GetPX() const     {return soa -> px[index];}
+          double  GetPY() const     {return soa -> py[index];}
+          double  GetPZ() const     {return soa -> pz[index];}
+          double  GetRX() const     {return soa -> rx[index];}
+          double  GetRY() const     {return soa -> ry[index];}
+          double  GetRZ() const     {return soa -> rz[index];}
+          double  GetET() const     {return soa -> et[index];}
+
+          // convert row back into a ClustInfo
+          ClustInfo ToInfo() const {return soa -> GetInfo(index);}
+
+          // ctor
+          Row(const ClustInfoSoA* arg_soa, const size_t arg_index) : soa(arg_soa), index(arg_index) {}
+
+      };  // end Row definition
+
+      // columns
+      AlignedVector<int>     system;
+      AlignedVector<int>     id;
+      AlignedVector<int64_t> nTwr;
+      AlignedVector<double>  ene;
+      AlignedVector<double>  rho;
+      AlignedVector<double>  eta;
+      AlignedVector<double>  phi;
+      AlignedVector<double>  px;
+      AlignedVector<double>  py;
+      AlignedVector<double>  pz;
+      AlignedVector<double>  rx;
+      AlignedVector<double>  ry;
+      AlignedVector<double>  rz;
+      AlignedVector<double>  et;
+
+      // ranges of each store filled so far
+      vector<StoreRange> stores;
+
+      // container methods
+      void       Clear();
+      void       Reserve(const size_t size);
+      void       Resize(const size_t size);
+      void       Push(const ClustInfo& info);
+      void       Fill(const vector<ClustInfo>& infos);
+      size_t     Size()       const {return ene.size();}
+      size_t     GetNStores() const {return stores.size();}
+      StoreRange GetStore(const size_t iStore) const {return stores[iStore];}
+      Row        operator[](const size_t index) const {return Row(this, index);}
+      ClustInfo  GetInfo(const size_t index) const;
+
+      // default ctor/dtor
+      ClustInfoSoA();
+      ~ClustInfoSoA();
+
+      // ctor accepting arguments
+      ClustInfoSoA(const vector<ClustInfo>& infos);
+
+    };  // end ClustInfoSoA definition
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
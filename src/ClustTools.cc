@@ -12,6 +12,11 @@
 // namespace definition
 #include "ClustTools.h"
 
+// analysis utilities
+#include "NodeCache.h"
+#include "ClustInfoSoA.h"
+#include "ClustInterfaces.h"
+
 // make common namespaces implicit
 using namespace std;
 
@@ -42,6 +47,138 @@ namespace SColdQcdCorrelatorAnalysis {
   }  // end 'GetClustMomentum(double, ROOT::Math::XYZVector)'
 
 
+
+  // batched cluster methods --------------------------------------------------
+
+  void Tools::ComputeClusterKinematics(
+    const double* __restrict__ rx,
+    const double* __restrict__ ry,
+    const double* __restrict__ rz,
+    const double* __restrict__ ene,
+    const size_t nClust,
+    const ROOT::Math::XYZVector vtx,
+    double* __restrict__ px,
+    double* __restrict__ py,
+    double* __restrict__ pz,
+    double* __restrict__ eta,
+    double* __restrict__ phi,
+    double* __restrict__ et
+  ) {
+
+    // copy parameters into locals so the loop below has no aliasing
+    // and can be auto-vectorized
+    const double vx    = vtx.X();
+    const double vy    = vtx.Y();
+    const double vz    = vtx.Z();
+    const double mass2 = Const::MassPion() * Const::MassPion();
+
+    for (size_t iClust = 0; iClust < nClust; ++iClust) {
+
+      // get displacement (cf. 'GetDisplacement(...)')
+      const double dx   = rx[iClust] - vx;
+      const double dy   = ry[iClust] - vy;
+      const double dz   = rz[iClust] - vz;
+      const double rho2 = (dx * dx) + (dy * dy);
+      const double rXY  = sqrt(rho2);
+      const double invR = 1. / sqrt(rho2 + (dz * dz));
+
+      // scale unit displacement by magnitude of 3-momentum (cf. 'GetClustMomentum(...)')
+      const double scale = sqrt((ene[iClust] * ene[iClust]) - mass2) * invR;
+      px[iClust] = dx * scale;
+      py[iClust] = dy * scale;
+      pz[iClust] = dz * scale;
+
+      // direction only depends on the displacement
+      eta[iClust] = asinh(dz / rXY);
+      phi[iClust] = atan2(dy, dx);
+      et[iClust]  = ene[iClust] * rXY * invR;
+    }
+    return;
+
+  }  // end 'ComputeClusterKinematics(double*, double*, double*, double*, size_t, ROOT::Math::XYZVector, double*, double*, double*, double*, double*, double*)'
+
+
+
+  void Tools::ComputeClusterKinematics(
+    RawClusterContainer* store,
+    const ROOT::Math::XYZVector vtx,
+    Types::ClustInfoSoA& out,
+    const int sys
+  ) {
+
+    // append rows for this store
+    const size_t begin = out.Size();
+    const size_t end   = begin + store -> size();
+    out.Resize(end);
+
+    // gather raw cluster info into contiguous columns
+    size_t iRow = begin;
+    RawClusterContainer::ConstRange clusters = store -> getClusters();
+    for (
+      RawClusterContainer::ConstIterator itClust = clusters.first;
+      itClust != clusters.second;
+      ++itClust, ++iRow
+    ) {
+      const RawCluster* clust = itClust -> second;
+      out.system[iRow] = sys;
+      out.id[iRow]     = clust -> get_id();
+      out.nTwr[iRow]   = clust -> getNTowers();
+      out.ene[iRow]    = clust -> get_energy();
+      out.rho[iRow]    = clust -> get_r();
+      out.rx[iRow]     = clust -> get_position().x();
+      out.ry[iRow]     = clust -> get_position().y();
+      out.rz[iRow]     = clust -> get_position().z();
+    }  // end cluster loop
+
+    // then run kinematics over the whole range at once
+    ComputeClusterKinematics(
+      out.rx.data() + begin,
+      out.ry.data() + begin,
+      out.rz.data() + begin,
+      out.ene.data() + begin,
+      end - begin,
+      vtx,
+      out.px.data() + begin,
+      out.py.data() + begin,
+      out.pz.data() + begin,
+      out.eta.data() + begin,
+      out.phi.data() + begin,
+      out.et.data() + begin
+    );
+    out.stores.push_back({sys, begin, end});
+    return;
+
+  }  // end 'ComputeClusterKinematics(RawClusterContainer*, ROOT::Math::XYZVector, Types::ClustInfoSoA&, int)'
+
+
+
+  void Tools::ComputeClusterKinematics(PHCompositeNode* topNode, const ROOT::Math::XYZVector vtx, Types::ClustInfoSoA& out) {
+
+    Interfaces::NodeCache nodes(topNode);
+    ComputeClusterKinematics(nodes, vtx, out);
+    return;
+
+  }  // end 'ComputeClusterKinematics(PHCompositeNode*, ROOT::Math::XYZVector, Types::ClustInfoSoA&)'
+
+
+
+  void Tools::ComputeClusterKinematics(Interfaces::NodeCache& nodes, const ROOT::Math::XYZVector vtx, Types::ClustInfoSoA& out) {
+
+    // size columns once for all of the stores
+    size_t nTotal = out.Size();
+    for (const auto& [sys, node] : Const::MapIndexOntoNode()) {
+      nTotal += nodes.GetClusterStore(node) -> size();
+    }
+    out.Reserve(nTotal);
+
+    // and fill each store in turn
+    for (const auto& [sys, node] : Const::MapIndexOntoNode()) {
+      ComputeClusterKinematics(nodes.GetClusterStore(node), vtx, out, sys);
+    }
+    return;
+
+  }  // end 'ComputeClusterKinematics(Interfaces::NodeCache&, ROOT::Math::XYZVector, Types::ClustInfoSoA&)'
+
 }  // end SColdQcdCorrealtorAnalysis namespace
 
 
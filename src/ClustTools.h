@@ -12,9 +12,14 @@
 
 // c++ utilities
 #include <cmath>
+#include <vector>
 // root libraries
 #include <Math/Vector3D.h>
 #include <Math/Vector4D.h>
+// phool libraries
+#include <phool/PHCompositeNode.h>
+// CaloBase libraries
+#include <calobase/RawClusterContainer.h>
 // analysis utilities
 #include "Constants.h"
 
@@ -24,6 +29,15 @@ using namespace std;
 
 
 namespace SColdQcdCorrelatorAnalysis {
+
+  // forward declarations: n.b. ClustInfoSoA.h pulls in this header
+  namespace Types {
+    struct ClustInfoSoA;
+  }
+  namespace Interfaces {
+    class NodeCache;
+  }
+
   namespace Tools {
 
     // cluster methods --------------------------------------------------------
@@ -31,6 +45,31 @@ namespace SColdQcdCorrelatorAnalysis {
     ROOT::Math::XYZVector     GetDisplacement(const ROOT::Math::XYZVector pos, const ROOT::Math::XYZVector vtx);
     ROOT::Math::PxPyPzEVector GetClustMomentum(const double energy, const ROOT::Math::XYZVector pos, const ROOT::Math::XYZVector vtx);
 
+
+
+    // batched cluster kinematics ---------------------------------------------
+
+    // n.b. the container overloads append one store range per container
+    // to the SoA; the node overloads process every store in
+    // Const::MapIndexOntoNode()
+    void ComputeClusterKinematics(
+      const double* __restrict__ rx,
+      const double* __restrict__ ry,
+      const double* __restrict__ rz,
+      const double* __restrict__ ene,
+      const size_t nClust,
+      const ROOT::Math::XYZVector vtx,
+      double* __restrict__ px,
+      double* __restrict__ py,
+      double* __restrict__ pz,
+      double* __restrict__ eta,
+      double* __restrict__ phi,
+      double* __restrict__ et
+    );
+    void ComputeClusterKinematics(RawClusterContainer* store, const ROOT::Math::XYZVector vtx, Types::ClustInfoSoA& out, const int sys = Const::Subsys::EMCal);
+    void ComputeClusterKinematics(PHCompositeNode* topNode, const ROOT::Math::XYZVector vtx, Types::ClustInfoSoA& out);
+    void ComputeClusterKinematics(Interfaces::NodeCache& nodes, const ROOT::Math::XYZVector vtx, Types::ClustInfoSoA& out);
+
   }  // end Tools namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
 
@@ -0,0 +1,226 @@
+// ----------------------------------------------------------------------------
+// 'ConcurrentHist.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Histogram which several threads can fill at once, with
+// bins updated by relaxed atomics instead of per-thread copies.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CONCURRENTHIST_CC
+
+// class definition
+#include "ConcurrentHist.h"
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // ConcurrentHist getters --------------------------------------------------
+
+  template <typename THist> uint64_t Types::ConcurrentHist<THist>::GetEntries() const {
+
+    uint64_t nEntries = 0;
+    for (const Counter& counter : entries) {
+      nEntries += counter.n.load(memory_order_relaxed);
+    }
+    return nEntries;
+
+  }  // end 'GetEntries()'
+
+
+
+  // ConcurrentHist public methods --------------------------------------------
+
+  template <typename THist> void Types::ConcurrentHist<THist>::Reset() {
+
+    for (size_t iBin = 0; iBin < nBins; ++iBin) {
+      content[iBin].store(0., memory_order_relaxed);
+      sumw2[iBin].store(0., memory_order_relaxed);
+    }
+    for (Counter& counter : entries) {
+      counter.n.store(0, memory_order_relaxed);
+    }
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  template <typename THist> THist Types::ConcurrentHist<THist>::GetHist() const {
+
+    vector<double> contentOut(nBins);
+    vector<double> sumw2Out(nBins);
+    for (size_t iBin = 0; iBin < nBins; ++iBin) {
+      contentOut[iBin] = content[iBin].load(memory_order_relaxed);
+      sumw2Out[iBin]   = sumw2[iBin].load(memory_order_relaxed);
+    }
+
+    THist hist = binning;
+    hist.Reset();
+    hist.SetContent(contentOut, sumw2Out, (double) GetEntries());
+    return hist;
+
+  }  // end 'GetHist()'
+
+
+
+  template <typename THist> void Types::ConcurrentHist<THist>::Fill(const double x, const double weight) {
+
+    FillBin(binning.FindGlobalBin(x), weight);
+    return;
+
+  }  // end 'Fill(double, double)'
+
+
+
+  template <typename THist> void Types::ConcurrentHist<THist>::Fill(const double x, const double y, const double weight) {
+
+    FillBin(binning.FindGlobalBin(x, y), weight);
+    return;
+
+  }  // end 'Fill(double, double, double)'
+
+
+
+  template <typename THist> void Types::ConcurrentHist<THist>::Fill(const double x, const double y, const double z, const double weight) {
+
+    FillBin(binning.FindGlobalBin(x, y, z), weight);
+    return;
+
+  }  // end 'Fill(double, double, double, double)'
+
+
+
+  // ConcurrentHist ctor/dtor -------------------------------------------------
+
+  template <typename THist> Types::ConcurrentHist<THist>::ConcurrentHist(const THist& prototype) : binning(prototype) {
+
+    // n.b. binning is only used for its axes, so drop its bins
+    nBins = prototype.GetContent().size();
+    binning.Release();
+    content = make_unique<atomic<double>[]>(nBins);
+    sumw2   = make_unique<atomic<double>[]>(nBins);
+    Reset();
+
+  }  // end ctor(THist&)
+
+
+
+  template <typename THist> Types::ConcurrentHist<THist>::~ConcurrentHist() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  // Buffer internal methods --------------------------------------------------
+
+  template <typename THist> void Types::ConcurrentHist<THist>::Buffer::FlushSlot(Slot& slot) {
+
+    if (slot.nFill == 0) return;
+
+    AtomicAdd(hist -> content[slot.bin], slot.sumW);
+    AtomicAdd(hist -> sumw2[slot.bin], slot.sumW2);
+    nEntries += slot.nFill;
+
+    slot = Slot();
+    return;
+
+  }  // end 'FlushSlot(Slot&)'
+
+
+
+  // Buffer public methods ----------------------------------------------------
+
+  template <typename THist> void Types::ConcurrentHist<THist>::Buffer::Flush() {
+
+    for (Slot& slot : slots) {
+      FlushSlot(slot);
+    }
+    hist -> GetCounter().n.fetch_add(nEntries, memory_order_relaxed);
+    nEntries = 0;
+    return;
+
+  }  // end 'Flush()'
+
+
+
+  template <typename THist> void Types::ConcurrentHist<THist>::Buffer::FillBin(const size_t bin, const double weight) {
+
+    // evict whatever else occupies the slot
+    Slot& slot = slots[bin & mask];
+    if (slot.bin != bin) {
+      FlushSlot(slot);
+      slot.bin = bin;
+    }
+
+    // n.b. sumw2 needs each weight squared individually
+    slot.sumW  += weight;
+    slot.sumW2 += weight * weight;
+    ++slot.nFill;
+    return;
+
+  }  // end 'FillBin(size_t, double)'
+
+
+
+  // Buffer ctor/dtor ---------------------------------------------------------
+
+  template <typename THist> Types::ConcurrentHist<THist>::Buffer::Buffer(ConcurrentHist& arg_hist, const size_t nSlots) : hist(&arg_hist) {
+
+    // round table size up to a power of two
+    size_t size = 1;
+    while (size < nSlots) {
+      size <<= 1;
+    }
+    mask = size - 1;
+    slots.resize(size);
+
+  }  // end ctor(ConcurrentHist&, size_t)
+
+
+
+  template <typename THist> Types::ConcurrentHist<THist>::Buffer::~Buffer() {
+
+    Flush();
+
+  }  // end dtor()
+
+
+
+  // explicit instantiations --------------------------------------------------
+
+  // n.b. members are instantiated one at a time so each histogram
+  // only gets the fill overload matching its dimension
+  template uint64_t Types::ConcurrentHist<Types::CorrHist1D>::GetEntries() const;
+  template void Types::ConcurrentHist<Types::CorrHist1D>::Reset();
+  template Types::CorrHist1D Types::ConcurrentHist<Types::CorrHist1D>::GetHist() const;
+  template void Types::ConcurrentHist<Types::CorrHist1D>::Fill(const double x, const double weight);
+  template Types::ConcurrentHist<Types::CorrHist1D>::ConcurrentHist(const Types::CorrHist1D& prototype);
+  template Types::ConcurrentHist<Types::CorrHist1D>::~ConcurrentHist();
+  template class Types::ConcurrentHist<Types::CorrHist1D>::Buffer;
+
+  template uint64_t Types::ConcurrentHist<Types::CorrHist2D>::GetEntries() const;
+  template void Types::ConcurrentHist<Types::CorrHist2D>::Reset();
+  template Types::CorrHist2D Types::ConcurrentHist<Types::CorrHist2D>::GetHist() const;
+  template void Types::ConcurrentHist<Types::CorrHist2D>::Fill(const double x, const double y, const double weight);
+  template Types::ConcurrentHist<Types::CorrHist2D>::ConcurrentHist(const Types::CorrHist2D& prototype);
+  template Types::ConcurrentHist<Types::CorrHist2D>::~ConcurrentHist();
+  template class Types::ConcurrentHist<Types::CorrHist2D>::Buffer;
+
+  template uint64_t Types::ConcurrentHist<Types::CorrHist3D>::GetEntries() const;
+  template void Types::ConcurrentHist<Types::CorrHist3D>::Reset();
+  template Types::CorrHist3D Types::ConcurrentHist<Types::CorrHist3D>::GetHist() const;
+  template void Types::ConcurrentHist<Types::CorrHist3D>::Fill(const double x, const double y, const double z, const double weight);
+  template Types::ConcurrentHist<Types::CorrHist3D>::ConcurrentHist(const Types::CorrHist3D& prototype);
+  template Types::ConcurrentHist<Types::CorrHist3D>::~ConcurrentHist();
+  template class Types::ConcurrentHist<Types::CorrHist3D>::Buffer;
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// 'ConcurrentHist.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Histogram which several threads can fill at once, with
+// bins updated by relaxed atomics instead of per-thread copies.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CONCURRENTHIST_H
+#define SCORRELATORUTILITIES_CONCURRENTHIST_H
+
+// c++ utilities
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <functional>
+// analysis utilities
+#include "CorrHist.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // ConcurrentHist definition ----------------------------------------------
+
+    // n.b. THist is one of CorrHist1D/2D/3D and sets the binning; only
+    // the Fill overload matching its dimension can be used
+    template <typename THist> class ConcurrentHist {
+
+      private:
+
+        // n.b. entries are spread over counters on separate cache lines,
+        // so threads don't all hit the same atomic on every fill
+        static constexpr size_t NCounters = 16;
+        struct alignas(64) Counter {
+          atomic<uint64_t> n {0};
+        };
+
+        // binning (axes only) and atomic bin storage
+        THist                        binning;
+        size_t                       nBins = 0;
+        unique_ptr<atomic<double>[]> content;
+        unique_ptr<atomic<double>[]> sumw2;
+        Counter                      entries[NCounters];
+
+        // relaxed fetch-add for doubles
+        static void AtomicAdd(atomic<double>& target, const double value) {
+          double expected = target.load(memory_order_relaxed);
+          while (!target.compare_exchange_weak(expected, expected + value, memory_order_relaxed, memory_order_relaxed)) {}
+        }
+
+        // entry counter for the calling thread
+        Counter& GetCounter() {
+          thread_local const size_t iCounter = hash<thread::id>()(this_thread::get_id()) % NCounters;
+          return entries[iCounter];
+        }
+
+      public:
+
+        // per-thread write-combining buffer: repeated fills of a bin are
+        // summed locally in a small direct-mapped table, and a slot is only
+        // written out (atomically) when it's evicted or on Flush()
+        class Buffer {
+
+          private:
+
+            // one slot of the table
+            struct Slot {
+              size_t   bin   = numeric_limits<size_t>::max();
+              double   sumW  = 0.;
+              double   sumW2 = 0.;
+              uint64_t nFill = 0;
+            };
+
+            // data members: n.b. entries are only passed on in Flush()
+            ConcurrentHist* hist     = NULL;
+            size_t          mask     = 0;
+            uint64_t        nEntries = 0;
+            vector<Slot>    slots;
+
+            // internal methods
+            void FlushSlot(Slot& slot);
+
+          public:
+
+            // getters
+            size_t GetNBytes() const {return sizeof(Buffer) + (slots.size() * sizeof(Slot));}
+
+            // public methods
+            void Flush();
+            void FillBin(const size_t bin, const double weight);
+
+            // ctor/dtor: n.b. the dtor flushes anything left
+            Buffer(ConcurrentHist& arg_hist, const size_t nSlots = 1024);
+            ~Buffer();
+
+            // not copyable: owns pending fills
+            Buffer(const Buffer&)            = delete;
+            Buffer& operator=(const Buffer&) = delete;
+
+        };  // end Buffer definition
+
+        // getters
+        const THist& GetBinning() const {return binning;}
+        size_t       GetNBins()   const {return nBins;}
+        size_t       GetNBytes()  const {return sizeof(ConcurrentHist) + (nBins * 2 * sizeof(atomic<double>));}
+        uint64_t     GetEntries() const;
+
+        // public methods: n.b. Reset() and GetHist() shouldn't race with fills
+        void  Reset();
+        THist GetHist() const;
+
+        // fill methods: n.b. weights are required so that a 2D fill
+        // can't be mistaken for a weighted 1D fill
+        void FillBin(const size_t bin, const double weight) {
+          AtomicAdd(content[bin], weight);
+          AtomicAdd(sumw2[bin], weight * weight);
+          GetCounter().n.fetch_add(1, memory_order_relaxed);
+        }
+        void Fill(const double x, const double weight);
+        void Fill(const double x, const double y, const double weight);
+        void Fill(const double x, const double y, const double z, const double weight);
+
+        // ctor/dtor
+        ConcurrentHist(const THist& prototype);
+        ~ConcurrentHist();
+
+        // not copyable: owns atomics
+        ConcurrentHist(const ConcurrentHist&)            = delete;
+        ConcurrentHist& operator=(const ConcurrentHist&) = delete;
+
+    };  // end ConcurrentHist definition
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
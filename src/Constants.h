@@ -12,6 +12,8 @@
 
 // c++ utilities
 #include <map>
+#include <array>
+#include <limits>
 #include <string>
 #include <cstdint>
 // fastjet libraries
@@ -42,6 +44,15 @@ namespace SColdQcdCorrelatorAnalysis {
     // object types
     enum Object {Track, Cluster, Flow, Particle, Unknown};
 
+    // simd instruction sets for correlator kernels
+    enum class Simd {Auto, Scalar, AVX2, AVX512};
+
+    // unique-assignment algorithms for matching
+    enum class MatchAlgo {Auto, Greedy, Hungarian};
+
+    // leaf types of info members
+    enum class Leaf {Bool, Int, Int64, UInt32, UInt64, Float, Double};
+
     // subsystem indices
     enum Subsys {Mvtx, Intt, Tpc, EMCal, IHCal, OHCal};
 
@@ -110,49 +121,132 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
-    // maps -------------------------------------------------------------------
+    // pdg properties ---------------------------------------------------------
 
-    // map of PID onto charges
-    inline map<int, float> &MapPidOntoCharge() {
-      static map<int, float> mapPidOntoCharge = {
-        {1, -1./3.},
-        {2, 2./3.}, 
-        {3, -1./3.},
-        {4, 2./3.},
-        {5, -1./3},
-        {6, 2./3.},
-        {11, -1.},
-        {12, 0.},
-        {13, -1.},
-        {14, 0.},
-        {15, -1.},
-        {16, 0.},
-        {22, 0.},
-        {23, 0.},
-        {24, 1.},
-        {111, 0.},
-        {130, 0.},
-        {211, 1.},
-        {221, 0.},
-        {310, 0.},
-        {321, 1.},
-        {421, 0.},
-        {431, 1.},
-        {441, 1.},
-        {2112, 1.},
-        {2212, 1.},
-        {3112, -1.},
-        {3122, 0.},
-        {3212, 0.},
-        {3222, 1.},
-        {3322, 0.},
-        {700201, 0.},
-        {700202, 2.},
-        {700301, 0.},
-        {700302, 3.}
-      };
-      return mapPidOntoCharge;
+    // broad particle classes
+    enum class PdgClass {Unknown, Parton, Lepton, Boson, Hadron, Ion};
+
+    // properties of a single pdg code
+    struct PdgInfo {
+      int      pid;
+      float    charge;
+      double   mass;
+      PdgClass type;
+    };
+
+    // table of known pdg codes, sorted by pid: n.b. antiparticles are
+    // looked up by |pid| with the charge flipped, and masses (in GeV)
+    // of nuclei are left as the usual max sentinel
+    inline constexpr array<PdgInfo, 40> PdgTable = {{
+      {1,      -1./3., 0.00467,                       PdgClass::Parton},
+      {2,      2./3.,  0.00216,                       PdgClass::Parton},
+      {3,      -1./3., 0.0934,                        PdgClass::Parton},
+      {4,      2./3.,  1.27,                          PdgClass::Parton},
+      {5,      -1./3., 4.18,                          PdgClass::Parton},
+      {6,      2./3.,  172.69,                        PdgClass::Parton},
+      {11,     -1.,    0.000510999,                   PdgClass::Lepton},
+      {12,     0.,     0.,                            PdgClass::Lepton},
+      {13,     -1.,    0.105658,                      PdgClass::Lepton},
+      {14,     0.,     0.,                            PdgClass::Lepton},
+      {15,     -1.,    1.77686,                       PdgClass::Lepton},
+      {16,     0.,     0.,                            PdgClass::Lepton},
+      {21,     0.,     0.,                            PdgClass::Parton},
+      {22,     0.,     0.,                            PdgClass::Boson},
+      {23,     0.,     91.1876,                       PdgClass::Boson},
+      {24,     1.,     80.377,                        PdgClass::Boson},
+      {111,    0.,     0.134977,                      PdgClass::Hadron},
+      {130,    0.,     0.497611,                      PdgClass::Hadron},
+      {211,    1.,     0.139570,                      PdgClass::Hadron},
+      {221,    0.,     0.547862,                      PdgClass::Hadron},
+      {310,    0.,     0.497611,                      PdgClass::Hadron},
+      {311,    0.,     0.497611,                      PdgClass::Hadron},
+      {321,    1.,     0.493677,                      PdgClass::Hadron},
+      {411,    1.,     1.86966,                       PdgClass::Hadron},
+      {421,    0.,     1.86484,                       PdgClass::Hadron},
+      {431,    1.,     1.96835,                       PdgClass::Hadron},
+      {441,    0.,     2.9839,                        PdgClass::Hadron},
+      {2112,   0.,     0.939565,                      PdgClass::Hadron},
+      {2212,   1.,     0.938272,                      PdgClass::Hadron},
+      {3112,   -1.,    1.197449,                      PdgClass::Hadron},
+      {3122,   0.,     1.115683,                      PdgClass::Hadron},
+      {3212,   0.,     1.192642,                      PdgClass::Hadron},
+      {3222,   1.,     1.18937,                       PdgClass::Hadron},
+      {3312,   -1.,    1.32171,                       PdgClass::Hadron},
+      {3322,   0.,     1.31486,                       PdgClass::Hadron},
+      {3334,   -1.,    1.67245,                       PdgClass::Hadron},
+      {700201, 0.,     numeric_limits<double>::max(), PdgClass::Ion},
+      {700202, 2.,     numeric_limits<double>::max(), PdgClass::Ion},
+      {700301, 0.,     numeric_limits<double>::max(), PdgClass::Ion},
+      {700302, 3.,     numeric_limits<double>::max(), PdgClass::Ion}
+    }};
+
+    // dense index of small pdg codes into PdgTable (-1 if unknown)
+    inline constexpr size_t NPdgDense = 512;
+    inline constexpr array<int16_t, NPdgDense> PdgDenseIndex = []() {
+      array<int16_t, NPdgDense> index {};
+      for (size_t iCode = 0; iCode < NPdgDense; ++iCode) {
+        index[iCode] = -1;
+      }
+      for (size_t iPdg = 0; iPdg < PdgTable.size(); ++iPdg) {
+        if (PdgTable[iPdg].pid < (int) NPdgDense) {
+          index[PdgTable[iPdg].pid] = (int16_t) iPdg;
+        }
+      }
+      return index;
+    }();
+
+    // make sure table stays sorted for the fallback search
+    inline constexpr bool IsPdgTableSorted() {
+      for (size_t iPdg = 1; iPdg < PdgTable.size(); ++iPdg) {
+        if (PdgTable[iPdg - 1].pid >= PdgTable[iPdg].pid) return false;
+      }
+      return true;
     }
+    static_assert(IsPdgTableSorted(), "PdgTable must be sorted by pid");
+
+    // look up a pdg code: dense array for small codes, binary search
+    // otherwise; returns NULL if the code isn't in the table
+    inline constexpr const PdgInfo* FindPdgInfo(const int pid) {
+      const int code = (pid < 0) ? -pid : pid;
+      if (code < (int) NPdgDense) {
+        const int16_t iPdg = PdgDenseIndex[code];
+        return (iPdg < 0) ? NULL : &PdgTable[iPdg];
+      }
+      size_t lo = 0;
+      size_t hi = PdgTable.size();
+      while (lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        if (PdgTable[mid].pid < code) {
+          lo = mid + 1;
+        } else {
+          hi = mid;
+        }
+      }
+      return ((lo < PdgTable.size()) && (PdgTable[lo].pid == code)) ? &PdgTable[lo] : NULL;
+    }
+
+    // sign-aware charge of a pdg code (0 if unknown)
+    inline constexpr float GetPdgCharge(const int pid) {
+      const PdgInfo* info = FindPdgInfo(pid);
+      if (!info || (info -> charge == 0.)) return 0.;
+      return (pid < 0) ? -(info -> charge) : info -> charge;
+    }
+
+    // mass of a pdg code (max sentinel if unknown)
+    inline constexpr double GetPdgMass(const int pid) {
+      const PdgInfo* info = FindPdgInfo(pid);
+      return info ? info -> mass : numeric_limits<double>::max();
+    }
+
+    // class of a pdg code
+    inline constexpr PdgClass GetPdgClass(const int pid) {
+      const PdgInfo* info = FindPdgInfo(pid);
+      return info ? info -> type : PdgClass::Unknown;
+    }
+
+
+
+    // maps -------------------------------------------------------------------
 
     // map of node name onto subsystem index
     inline map<string, int> MapNodeOntoIndex() {
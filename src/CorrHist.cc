@@ -0,0 +1,595 @@
+// ----------------------------------------------------------------------------
+// 'CorrHist.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Lightweight log-binned histogram types for accumulating
+// correlator pairs without going through ROOT.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CORRHIST_CC
+
+// class definition
+#include "CorrHist.h"
+
+// c++ utilities
+#include <algorithm>
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // LogAxis public methods ---------------------------------------------------
+
+  void Types::LogAxis::Set(const size_t arg_nBins, const double arg_xMin, const double arg_xMax) {
+
+    // make sure axis is sensible
+    if ((arg_nBins == 0) || (arg_xMin <= 0.) || (arg_xMax <= arg_xMin)) {
+      cerr << PHWHERE << "PANIC: trying to set log axis with bad parameters! nBins = " << arg_nBins << ", min = " << arg_xMin << ", max = " << arg_xMax << endl;
+      assert((arg_nBins > 0) && (arg_xMin > 0.) && (arg_xMax > arg_xMin));
+    }
+
+    nBins = arg_nBins;
+    xMin  = arg_xMin;
+    xMax  = arg_xMax;
+
+    // bins are uniform in log(x), so also uniform in log(x^2)
+    logMin2  = 2. * log(xMin);
+    invStep2 = (double) nBins / (2. * (log(xMax) - log(xMin)));
+
+    // guess = (log(x^2) - logMin2) * invStep2, from log2(x^2)
+    guessMul = M_LN2 * invStep2;
+    guessOff = logMin2 * invStep2;
+
+    // precompute edges in both x and x^2
+    edges.resize(nBins + 1);
+    edges2.resize(nBins + 1);
+    for (size_t iEdge = 0; iEdge <= nBins; ++iEdge) {
+      edges[iEdge]  = exp(log(xMin) + (((double) iEdge / (double) nBins) * (log(xMax) - log(xMin))));
+      edges2[iEdge] = edges[iEdge] * edges[iEdge];
+    }
+    edges.front()  = xMin;
+    edges.back()   = xMax;
+    edges2.front() = xMin * xMin;
+    edges2.back()  = xMax * xMax;
+
+    // check fast guess lands within a bin of the right one across the
+    // whole axis (at each edge and each bin center), else use exact log
+    useFast = true;
+    for (size_t iBin = 0; iBin < nBins; ++iBin) {
+      const double center2 = edges2[iBin] * sqrt(edges2[iBin + 1] / edges2[iBin]);
+      for (const double x2 : {edges2[iBin], center2}) {
+        if (fabs(floor(GuessBin(x2)) - (double) iBin) > 1.) {
+          useFast = false;
+          break;
+        }
+      }
+      if (!useFast) break;
+    }
+    return;
+
+  }  // end 'Set(size_t, double, double)'
+
+
+
+  // LogAxis ctor/dtor --------------------------------------------------------
+
+  Types::LogAxis::LogAxis() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::LogAxis::~LogAxis() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::LogAxis::LogAxis(const size_t arg_nBins, const double arg_xMin, const double arg_xMax) {
+
+    Set(arg_nBins, arg_xMin, arg_xMax);
+
+  }  // end ctor(size_t, double, double)
+
+
+
+  // LinAxis public methods ---------------------------------------------------
+
+  void Types::LinAxis::Set(const size_t arg_nBins, const double arg_xMin, const double arg_xMax) {
+
+    // make sure axis is sensible
+    if ((arg_nBins == 0) || (arg_xMax <= arg_xMin)) {
+      cerr << PHWHERE << "PANIC: trying to set linear axis with bad parameters! nBins = " << arg_nBins << ", min = " << arg_xMin << ", max = " << arg_xMax << endl;
+      assert((arg_nBins > 0) && (arg_xMax > arg_xMin));
+    }
+
+    nBins    = arg_nBins;
+    xMin     = arg_xMin;
+    xMax     = arg_xMax;
+    invWidth = (double) nBins / (xMax - xMin);
+    return;
+
+  }  // end 'Set(size_t, double, double)'
+
+
+
+  vector<double> Types::LinAxis::GetEdges() const {
+
+    vector<double> edges(nBins + 1);
+    for (size_t iEdge = 0; iEdge <= nBins; ++iEdge) {
+      edges[iEdge] = xMin + (((double) iEdge / (double) nBins) * (xMax - xMin));
+    }
+    return edges;
+
+  }  // end 'GetEdges()'
+
+
+
+  // LinAxis ctor/dtor --------------------------------------------------------
+
+  Types::LinAxis::LinAxis() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::LinAxis::~LinAxis() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::LinAxis::LinAxis(const size_t arg_nBins, const double arg_xMin, const double arg_xMax) {
+
+    Set(arg_nBins, arg_xMin, arg_xMax);
+
+  }  // end ctor(size_t, double, double)
+
+
+
+  // CorrHist1D public methods ------------------------------------------------
+
+  void Types::CorrHist1D::Reset() {
+
+    content.assign(axis.GetNBins() + 2, 0.);
+    sumw2.assign(axis.GetNBins() + 2, 0.);
+    entries = 0.;
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Types::CorrHist1D::Release() {
+
+    // n.b. keeps only the binning; Reset() reallocates the bins
+    vector<double>().swap(content);
+    vector<double>().swap(sumw2);
+    entries = 0.;
+    return;
+
+  }  // end 'Release()'
+
+
+
+  void Types::CorrHist1D::Add(const CorrHist1D& other) {
+
+    // make sure binning is compatible
+    if (other.content.size() != content.size()) {
+      cerr << PHWHERE << "PANIC: trying to add histograms with different binning!" << endl;
+      assert(other.content.size() == content.size());
+    }
+
+    for (size_t iBin = 0; iBin < content.size(); ++iBin) {
+      content[iBin] += other.content[iBin];
+      sumw2[iBin]   += other.sumw2[iBin];
+    }
+    entries += other.entries;
+    return;
+
+  }  // end 'Add(CorrHist1D&)'
+
+
+
+
+  void Types::CorrHist1D::SetContent(const vector<double>& arg_content, const vector<double>& arg_sumw2, const double arg_entries) {
+
+    // make sure binning is compatible
+    if ((arg_content.size() != content.size()) || (arg_sumw2.size() != sumw2.size())) {
+      cerr << PHWHERE << "PANIC: trying to set histogram content with different binning!" << endl;
+      assert((arg_content.size() == content.size()) && (arg_sumw2.size() == sumw2.size()));
+    }
+
+    content = arg_content;
+    sumw2   = arg_sumw2;
+    entries = arg_entries;
+    return;
+
+  }  // end 'SetContent(vector<double>&, vector<double>&, double)'
+
+
+
+  TH1D* Types::CorrHist1D::MakeTH1D(const string& name, const string& title) const {
+
+    // n.b. root and CorrHist1D use the same bin numbering, including
+    // under/overflow, and sumw2 is copied directly so nothing is lost
+    TH1D* hist = new TH1D(name.data(), title.data(), axis.GetNBins(), axis.GetEdges().data());
+    hist -> Sumw2();
+    for (size_t iBin = 0; iBin < content.size(); ++iBin) {
+      hist -> SetBinContent(iBin, content[iBin]);
+      hist -> GetSumw2() -> SetAt(sumw2[iBin], iBin);
+    }
+    hist -> SetEntries(entries);
+    return hist;
+
+  }  // end 'MakeTH1D(string&, string&)'
+
+
+
+  // CorrHist1D ctor/dtor -----------------------------------------------------
+
+  Types::CorrHist1D::CorrHist1D() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::CorrHist1D::~CorrHist1D() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::CorrHist1D::CorrHist1D(const LogAxis& arg_axis) {
+
+    axis = arg_axis;
+    Reset();
+
+  }  // end ctor(LogAxis&)
+
+
+
+  Types::CorrHist1D::CorrHist1D(const size_t nBins, const double xMin, const double xMax) {
+
+    axis.Set(nBins, xMin, xMax);
+    Reset();
+
+  }  // end ctor(size_t, double, double)
+
+
+
+  // CorrHist2D public methods ------------------------------------------------
+
+  void Types::CorrHist2D::Reset() {
+
+    nX = xAxis.GetNBins() + 2;
+    nY = yAxis.GetNBins() + 2;
+    content.assign(nX * nY, 0.);
+    sumw2.assign(nX * nY, 0.);
+    entries = 0.;
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Types::CorrHist2D::Release() {
+
+    // n.b. keeps only the binning; Reset() reallocates the bins
+    vector<double>().swap(content);
+    vector<double>().swap(sumw2);
+    entries = 0.;
+    return;
+
+  }  // end 'Release()'
+
+
+
+  void Types::CorrHist2D::Add(const CorrHist2D& other) {
+
+    // make sure binning is compatible
+    if (other.content.size() != content.size()) {
+      cerr << PHWHERE << "PANIC: trying to add histograms with different binning!" << endl;
+      assert(other.content.size() == content.size());
+    }
+
+    for (size_t iBin = 0; iBin < content.size(); ++iBin) {
+      content[iBin] += other.content[iBin];
+      sumw2[iBin]   += other.sumw2[iBin];
+    }
+    entries += other.entries;
+    return;
+
+  }  // end 'Add(CorrHist2D&)'
+
+
+
+
+  void Types::CorrHist2D::SetContent(const vector<double>& arg_content, const vector<double>& arg_sumw2, const double arg_entries) {
+
+    // make sure binning is compatible
+    if ((arg_content.size() != content.size()) || (arg_sumw2.size() != sumw2.size())) {
+      cerr << PHWHERE << "PANIC: trying to set histogram content with different binning!" << endl;
+      assert((arg_content.size() == content.size()) && (arg_sumw2.size() == sumw2.size()));
+    }
+
+    content = arg_content;
+    sumw2   = arg_sumw2;
+    entries = arg_entries;
+    return;
+
+  }  // end 'SetContent(vector<double>&, vector<double>&, double)'
+
+
+
+  TH2D* Types::CorrHist2D::MakeTH2D(const string& name, const string& title) const {
+
+    const vector<double> yEdges = yAxis.GetEdges();
+
+    TH2D* hist = new TH2D(
+      name.data(),
+      title.data(),
+      xAxis.GetNBins(),
+      xAxis.GetEdges().data(),
+      yAxis.GetNBins(),
+      yEdges.data()
+    );
+    hist -> Sumw2();
+
+    // n.b. root orders global bins differently, so map each bin over
+    for (size_t xBin = 0; xBin < nX; ++xBin) {
+      for (size_t yBin = 0; yBin < nY; ++yBin) {
+        const size_t bin     = GetBin(xBin, yBin);
+        const int    rootBin = hist -> GetBin(xBin, yBin);
+        hist -> SetBinContent(rootBin, content[bin]);
+        hist -> GetSumw2() -> SetAt(sumw2[bin], rootBin);
+      }
+    }
+    hist -> SetEntries(entries);
+    return hist;
+
+  }  // end 'MakeTH2D(string&, string&)'
+
+
+
+  // CorrHist2D ctor/dtor -----------------------------------------------------
+
+  Types::CorrHist2D::CorrHist2D() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::CorrHist2D::~CorrHist2D() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::CorrHist2D::CorrHist2D(const LogAxis& arg_xAxis, const LinAxis& arg_yAxis) {
+
+    xAxis = arg_xAxis;
+    yAxis = arg_yAxis;
+    Reset();
+
+  }  // end ctor(LogAxis&, LinAxis&)
+
+
+
+  // CorrHist3D public methods ------------------------------------------------
+
+  void Types::CorrHist3D::Reset() {
+
+    nX = xAxis.GetNBins() + 2;
+    nY = yAxis.GetNBins() + 2;
+    nZ = zAxis.GetNBins() + 2;
+    content.assign(nX * nY * nZ, 0.);
+    sumw2.assign(nX * nY * nZ, 0.);
+    entries = 0.;
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Types::CorrHist3D::Release() {
+
+    // n.b. keeps only the binning; Reset() reallocates the bins
+    vector<double>().swap(content);
+    vector<double>().swap(sumw2);
+    entries = 0.;
+    return;
+
+  }  // end 'Release()'
+
+
+
+  void Types::CorrHist3D::Add(const CorrHist3D& other) {
+
+    // make sure binning is compatible
+    if (other.content.size() != content.size()) {
+      cerr << PHWHERE << "PANIC: trying to add histograms with different binning!" << endl;
+      assert(other.content.size() == content.size());
+    }
+
+    for (size_t iBin = 0; iBin < content.size(); ++iBin) {
+      content[iBin] += other.content[iBin];
+      sumw2[iBin]   += other.sumw2[iBin];
+    }
+    entries += other.entries;
+    return;
+
+  }  // end 'Add(CorrHist3D&)'
+
+
+
+
+  void Types::CorrHist3D::SetContent(const vector<double>& arg_content, const vector<double>& arg_sumw2, const double arg_entries) {
+
+    // make sure binning is compatible
+    if ((arg_content.size() != content.size()) || (arg_sumw2.size() != sumw2.size())) {
+      cerr << PHWHERE << "PANIC: trying to set histogram content with different binning!" << endl;
+      assert((arg_content.size() == content.size()) && (arg_sumw2.size() == sumw2.size()));
+    }
+
+    content = arg_content;
+    sumw2   = arg_sumw2;
+    entries = arg_entries;
+    return;
+
+  }  // end 'SetContent(vector<double>&, vector<double>&, double)'
+
+
+
+  TH3D* Types::CorrHist3D::MakeTH3D(const string& name, const string& title) const {
+
+    const vector<double> yEdges = yAxis.GetEdges();
+    const vector<double> zEdges = zAxis.GetEdges();
+
+    TH3D* hist = new TH3D(
+      name.data(),
+      title.data(),
+      xAxis.GetNBins(),
+      xAxis.GetEdges().data(),
+      yAxis.GetNBins(),
+      yEdges.data(),
+      zAxis.GetNBins(),
+      zEdges.data()
+    );
+    hist -> Sumw2();
+
+    // n.b. root orders global bins differently, so map each bin over
+    for (size_t xBin = 0; xBin < nX; ++xBin) {
+      for (size_t yBin = 0; yBin < nY; ++yBin) {
+        for (size_t zBin = 0; zBin < nZ; ++zBin) {
+          const size_t bin     = GetBin(xBin, yBin, zBin);
+          const int    rootBin = hist -> GetBin(xBin, yBin, zBin);
+          hist -> SetBinContent(rootBin, content[bin]);
+          hist -> GetSumw2() -> SetAt(sumw2[bin], rootBin);
+        }
+      }
+    }
+    hist -> SetEntries(entries);
+    return hist;
+
+  }  // end 'MakeTH3D(string&, string&)'
+
+
+
+  // CorrHist3D ctor/dtor -----------------------------------------------------
+
+  Types::CorrHist3D::CorrHist3D() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::CorrHist3D::~CorrHist3D() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::CorrHist3D::CorrHist3D(const LogAxis& arg_xAxis, const LinAxis& arg_yAxis, const LinAxis& arg_zAxis) {
+
+    xAxis = arg_xAxis;
+    yAxis = arg_yAxis;
+    zAxis = arg_zAxis;
+    Reset();
+
+  }  // end ctor(LogAxis&, LinAxis&, LinAxis&)
+
+
+
+  // CorrHistShards public methods --------------------------------------------
+
+  template <typename THist> void Types::CorrHistShards<THist>::Reset() {
+
+    for (THist& shard : shards) {
+      shard.Reset();
+    }
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  template <typename THist> THist Types::CorrHistShards<THist>::Merge() const {
+
+    // make sure there's something to merge
+    if (shards.empty()) {
+      cerr << PHWHERE << "PANIC: trying to merge histogram shards, but there are none!" << endl;
+      assert(!shards.empty());
+    }
+
+    THist sum = shards.front();
+    for (size_t iShard = 1; iShard < shards.size(); ++iShard) {
+      sum.Add(shards[iShard]);
+    }
+    return sum;
+
+  }  // end 'Merge()'
+
+
+
+  // CorrHistShards ctor/dtor -------------------------------------------------
+
+  template <typename THist> Types::CorrHistShards<THist>::CorrHistShards() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  template <typename THist> Types::CorrHistShards<THist>::~CorrHistShards() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  template <typename THist> Types::CorrHistShards<THist>::CorrHistShards(const THist& prototype, const size_t nShards) {
+
+    // n.b. shards start empty even if the prototype isn't
+    shards.assign(max(nShards, (size_t) 1), prototype);
+    Reset();
+
+  }  // end ctor(THist&, size_t)
+
+
+
+  // explicit instantiations --------------------------------------------------
+
+  template class Types::CorrHistShards<Types::CorrHist1D>;
+  template class Types::CorrHistShards<Types::CorrHist2D>;
+  template class Types::CorrHistShards<Types::CorrHist3D>;
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,361 @@
+// ----------------------------------------------------------------------------
+// 'CorrHist.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Lightweight log-binned histogram types for accumulating
+// correlator pairs without going through ROOT.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CORRHIST_H
+#define SCORRELATORUTILITIES_CORRHIST_H
+
+// c++ utilities
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <iostream>
+// root libraries
+#include <TH1D.h>
+#include <TH2D.h>
+#include <TH3D.h>
+#include <TArrayD.h>
+// phool libraries
+#include <phool/phool.h>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // LogAxis definition -----------------------------------------------------
+
+    class LogAxis {
+
+      private:
+
+        // data members
+        size_t         nBins    = 0;
+        double         xMin     = 0.;
+        double         xMax     = 0.;
+        double         logMin2  = 0.;
+        double         invStep2 = 0.;
+        double         guessOff = 0.;
+        double         guessMul = 0.;
+        bool           useFast  = true;
+        vector<double> edges;
+        vector<double> edges2;
+
+        // cheap log2 from the ieee-754 exponent plus a quadratic in the
+        // mantissa: n.b. good to ~0.005, so it's only used as a guess
+        static double FastLog2(const double x) {
+          uint64_t bits;
+          memcpy(&bits, &x, sizeof(bits));
+          const double exponent = (double) ((int64_t) ((bits >> 52) & 0x7FF) - 1023);
+          bits = (bits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL;
+          double mantissa;
+          memcpy(&mantissa, &bits, sizeof(mantissa));
+          return exponent + ((((-0.34484843 * mantissa) + 2.02466578) * mantissa) - 1.67487759);
+        }
+
+        // fractional bin estimate for x^2: n.b. falls back to the exact
+        // log if Set() finds the fast one can miss by more than a bin
+        double GuessBin(const double x2) const {
+          return useFast ? (FastLog2(x2) * guessMul) - guessOff : (log(x2) - logMin2) * invStep2;
+        }
+
+      public:
+
+        // getters
+        size_t                GetNBins()  const {return nBins;}
+        double                GetMin()    const {return xMin;}
+        double                GetMax()    const {return xMax;}
+        const vector<double>& GetEdges()  const {return edges;}
+        const vector<double>& GetEdges2() const {return edges2;}
+
+        // public methods
+        void   Set(const size_t arg_nBins, const double arg_xMin, const double arg_xMax);
+        size_t FindBin(const double x) const {return (x > 0.) ? FindBinSquared(x * x) : 0;}
+
+        // n.b. bin 0 is underflow and bin nBins + 1 is overflow. The guess
+        // comes from the approximate log and is then walked to the exact
+        // squared edges, so the result is identical to a binary search
+        size_t FindBinSquared(const double x2) const {
+          if (!(x2 >= edges2.front())) return 0;
+          if (x2 >= edges2.back())     return nBins + 1;
+          const double guess = GuessBin(x2);
+          size_t       bin   = (guess > 0.) ? (size_t) guess : 0;
+          if (bin >= nBins) bin = nBins - 1;
+          while (x2 < edges2[bin])      --bin;
+          while (x2 >= edges2[bin + 1]) ++bin;
+          return bin + 1;
+        }
+
+        // default ctor/dtor
+        LogAxis();
+        ~LogAxis();
+
+        // ctor accepting arguments
+        LogAxis(const size_t arg_nBins, const double arg_xMin, const double arg_xMax);
+
+    };  // end LogAxis definition
+
+
+
+    // LinAxis definition -----------------------------------------------------
+
+    class LinAxis {
+
+      private:
+
+        // data members
+        size_t nBins    = 0;
+        double xMin     = 0.;
+        double xMax     = 0.;
+        double invWidth = 0.;
+
+      public:
+
+        // getters
+        size_t GetNBins() const {return nBins;}
+        double GetMin()   const {return xMin;}
+        double GetMax()   const {return xMax;}
+
+        // public methods
+        void           Set(const size_t arg_nBins, const double arg_xMin, const double arg_xMax);
+        vector<double> GetEdges() const;
+
+        // n.b. bin 0 is underflow and bin nBins + 1 is overflow
+        size_t FindBin(const double x) const {
+          if (!(x >= xMin)) return 0;
+          if (x >= xMax)    return nBins + 1;
+          const size_t bin = (size_t) ((x - xMin) * invWidth);
+          return ((bin < nBins) ? bin : nBins - 1) + 1;
+        }
+
+        // default ctor/dtor
+        LinAxis();
+        ~LinAxis();
+
+        // ctor accepting arguments
+        LinAxis(const size_t arg_nBins, const double arg_xMin, const double arg_xMax);
+
+    };  // end LinAxis definition
+
+
+
+    // CorrHist1D definition --------------------------------------------------
+
+    class CorrHist1D {
+
+      private:
+
+        // data members
+        LogAxis        axis;
+        double         entries = 0.;
+        vector<double> content;
+        vector<double> sumw2;
+
+      public:
+
+        // getters
+        const LogAxis&        GetAxis()    const {return axis;}
+        double                GetEntries() const {return entries;}
+        const vector<double>& GetContent() const {return content;}
+        const vector<double>& GetSumW2()   const {return sumw2;}
+        double                GetBinContent(const size_t bin) const {return content[bin];}
+        double                GetBinError(const size_t bin)   const {return sqrt(sumw2[bin]);}
+
+        // public methods
+        void   Reset();
+        void   Release();
+        void   Add(const CorrHist1D& other);
+        void   SetContent(const vector<double>& arg_content, const vector<double>& arg_sumw2, const double arg_entries);
+        size_t FindGlobalBin(const double x) const {return axis.FindBin(x);}
+        TH1D*  MakeTH1D(const string& name, const string& title = "") const;
+
+        // fill methods: n.b. bin 0 is underflow and bin nBins + 1 is overflow
+        void Fill(const double x, const double weight = 1.) {
+          FillBin(axis.FindBin(x), weight);
+        }
+        void FillSquared(const double x2, const double weight = 1.) {
+          FillBin(axis.FindBinSquared(x2), weight);
+        }
+        void FillBin(const size_t bin, const double weight) {
+          content[bin] += weight;
+          sumw2[bin]   += weight * weight;
+          entries      += 1.;
+        }
+
+        // default ctor/dtor
+        CorrHist1D();
+        ~CorrHist1D();
+
+        // ctors accepting arguments
+        CorrHist1D(const LogAxis& arg_axis);
+        CorrHist1D(const size_t nBins, const double xMin, const double xMax);
+
+    };  // end CorrHist1D definition
+
+
+
+    // CorrHist2D definition --------------------------------------------------
+
+    class CorrHist2D {
+
+      private:
+
+        // data members
+        LogAxis        xAxis;
+        LinAxis        yAxis;
+        size_t         nX      = 0;
+        size_t         nY      = 0;
+        double         entries = 0.;
+        vector<double> content;
+        vector<double> sumw2;
+
+      public:
+
+        // getters
+        const LogAxis&        GetXAxis()   const {return xAxis;}
+        const LinAxis&        GetYAxis()   const {return yAxis;}
+        double                GetEntries() const {return entries;}
+        const vector<double>& GetContent() const {return content;}
+        const vector<double>& GetSumW2()   const {return sumw2;}
+
+        // public methods
+        void   Reset();
+        void   Release();
+        void   Add(const CorrHist2D& other);
+        void   SetContent(const vector<double>& arg_content, const vector<double>& arg_sumw2, const double arg_entries);
+        TH2D*  MakeTH2D(const string& name, const string& title = "") const;
+        size_t GetBin(const size_t xBin, const size_t yBin) const {return (xBin * nY) + yBin;}
+        size_t FindGlobalBin(const double x, const double y) const {return GetBin(xAxis.FindBin(x), yAxis.FindBin(y));}
+        double GetBinContent(const size_t xBin, const size_t yBin) const {return content[GetBin(xBin, yBin)];}
+        double GetBinError(const size_t xBin, const size_t yBin)   const {return sqrt(sumw2[GetBin(xBin, yBin)]);}
+
+        // fill methods: n.b. each axis has under/overflow bins like CorrHist1D
+        void Fill(const double x, const double y, const double weight = 1.) {
+          FillBin(FindGlobalBin(x, y), weight);
+        }
+        void FillSquared(const double x2, const double y, const double weight = 1.) {
+          FillBin(GetBin(xAxis.FindBinSquared(x2), yAxis.FindBin(y)), weight);
+        }
+        void FillBin(const size_t bin, const double weight) {
+          content[bin] += weight;
+          sumw2[bin]   += weight * weight;
+          entries      += 1.;
+        }
+
+        // default ctor/dtor
+        CorrHist2D();
+        ~CorrHist2D();
+
+        // ctor accepting arguments
+        CorrHist2D(const LogAxis& arg_xAxis, const LinAxis& arg_yAxis);
+
+    };  // end CorrHist2D definition
+
+
+
+    // CorrHist3D definition --------------------------------------------------
+
+    class CorrHist3D {
+
+      private:
+
+        // data members
+        LogAxis        xAxis;
+        LinAxis        yAxis;
+        LinAxis        zAxis;
+        size_t         nX      = 0;
+        size_t         nY      = 0;
+        size_t         nZ      = 0;
+        double         entries = 0.;
+        vector<double> content;
+        vector<double> sumw2;
+
+      public:
+
+        // getters
+        const LogAxis&        GetXAxis()   const {return xAxis;}
+        const LinAxis&        GetYAxis()   const {return yAxis;}
+        const LinAxis&        GetZAxis()   const {return zAxis;}
+        double                GetEntries() const {return entries;}
+        const vector<double>& GetContent() const {return content;}
+        const vector<double>& GetSumW2()   const {return sumw2;}
+
+        // public methods
+        void   Reset();
+        void   Release();
+        void   Add(const CorrHist3D& other);
+        void   SetContent(const vector<double>& arg_content, const vector<double>& arg_sumw2, const double arg_entries);
+        TH3D*  MakeTH3D(const string& name, const string& title = "") const;
+        size_t GetBin(const size_t xBin, const size_t yBin, const size_t zBin) const {return (((xBin * nY) + yBin) * nZ) + zBin;}
+        size_t FindGlobalBin(const double x, const double y, const double z) const {return GetBin(xAxis.FindBin(x), yAxis.FindBin(y), zAxis.FindBin(z));}
+        double GetBinContent(const size_t xBin, const size_t yBin, const size_t zBin) const {return content[GetBin(xBin, yBin, zBin)];}
+        double GetBinError(const size_t xBin, const size_t yBin, const size_t zBin)   const {return sqrt(sumw2[GetBin(xBin, yBin, zBin)]);}
+
+        // fill method: n.b. each axis has under/overflow bins like CorrHist1D
+        void Fill(const double x, const double y, const double z, const double weight = 1.) {
+          const size_t bin = FindGlobalBin(x, y, z);
+          content[bin] += weight;
+          sumw2[bin]   += weight * weight;
+          entries      += 1.;
+        }
+
+        // default ctor/dtor
+        CorrHist3D();
+        ~CorrHist3D();
+
+        // ctor accepting arguments
+        CorrHist3D(const LogAxis& arg_xAxis, const LinAxis& arg_yAxis, const LinAxis& arg_zAxis);
+
+    };  // end CorrHist3D definition
+
+
+
+    // CorrHistShards definition ----------------------------------------------
+
+    // n.b. one copy of the histogram per thread, so fills need no
+    // synchronization; merge once at the end of the job
+    template <typename THist> class CorrHistShards {
+
+      private:
+
+        // data members
+        vector<THist> shards;
+
+      public:
+
+        // getters
+        size_t       GetNShards() const {return shards.size();}
+        THist&       GetShard(const size_t iShard)       {return shards[iShard];}
+        const THist& GetShard(const size_t iShard) const {return shards[iShard];}
+
+        // public methods
+        void  Reset();
+        THist Merge() const;
+
+        // default ctor/dtor
+        CorrHistShards();
+        ~CorrHistShards();
+
+        // ctor accepting arguments
+        CorrHistShards(const THist& prototype, const size_t nShards);
+
+    };  // end CorrHistShards definition
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,640 @@
+// ----------------------------------------------------------------------------
+// 'CorrTools.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Collection of correlator kernels utilized in the
+// sPHENIX Cold QCD Energy-Energy Correlator analysis.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CORRTOOLS_CC
+
+// header
+#include "CorrTools.h"
+
+// c++ utilities
+#include <chrono>
+#include <random>
+#include <thread>
+#include <functional>
+
+// simd intrinsics
+#if defined(__x86_64__) || defined(__i386__)
+  #define SCORRELATORUTILITIES_HAS_X86
+  #include <immintrin.h>
+#endif
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // simd dispatch ------------------------------------------------------------
+
+  Const::Simd Tools::GetSimdLevel() {
+
+    static const Const::Simd level = []() {
+#ifdef SCORRELATORUTILITIES_HAS_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f")) return Const::Simd::AVX512;
+      if (__builtin_cpu_supports("avx2"))    return Const::Simd::AVX2;
+#endif
+      return Const::Simd::Scalar;
+    }();
+    return level;
+
+  }  // end 'GetSimdLevel()'
+
+
+
+  Const::Simd Tools::ResolveSimdLevel(const Const::Simd request) {
+
+    const Const::Simd supported = GetSimdLevel();
+    if (request == Const::Simd::Auto) {
+      return supported;
+    }
+    return ((int) request > (int) supported) ? supported : request;
+
+  }  // end 'ResolveSimdLevel(Const::Simd)'
+
+
+
+  // pair-distance kernels ----------------------------------------------------
+
+  void Tools::FillDeltaR2Scalar(
+    const double etaA,
+    const double phiA,
+    const double* eta,
+    const double* phi,
+    const size_t nCsts,
+    double* dr2
+  ) {
+
+    for (size_t iCst = 0; iCst < nCsts; ++iCst) {
+      const double dEta    = eta[iCst] - etaA;
+      const double dPhiAbs = fabs(phi[iCst] - phiA);
+      const double dPhi    = min(dPhiAbs, (2. * M_PI) - dPhiAbs);
+      dr2[iCst] = (dEta * dEta) + (dPhi * dPhi);
+    }
+    return;
+
+  }  // end 'FillDeltaR2Scalar(double, double, double*, double*, size_t, double*)'
+
+
+
+#ifdef SCORRELATORUTILITIES_HAS_X86
+  __attribute__((target("avx2")))
+#endif
+  void Tools::FillDeltaR2AVX2(
+    const double etaA,
+    const double phiA,
+    const double* eta,
+    const double* phi,
+    const size_t nCsts,
+    double* dr2
+  ) {
+
+#ifdef SCORRELATORUTILITIES_HAS_X86
+    const __m256d vEtaA  = _mm256_set1_pd(etaA);
+    const __m256d vPhiA  = _mm256_set1_pd(phiA);
+    const __m256d vTwoPi = _mm256_set1_pd(2. * M_PI);
+    const __m256d vSign  = _mm256_set1_pd(-0.);
+
+    // 4 lanes at a time
+    size_t iCst = 0;
+    for (; (iCst + 4) <= nCsts; iCst += 4) {
+      const __m256d dEta    = _mm256_sub_pd(_mm256_loadu_pd(eta + iCst), vEtaA);
+      const __m256d dPhiAbs = _mm256_andnot_pd(vSign, _mm256_sub_pd(_mm256_loadu_pd(phi + iCst), vPhiA));
+      const __m256d dPhi    = _mm256_min_pd(dPhiAbs, _mm256_sub_pd(vTwoPi, dPhiAbs));
+      _mm256_storeu_pd(dr2 + iCst, _mm256_add_pd(_mm256_mul_pd(dEta, dEta), _mm256_mul_pd(dPhi, dPhi)));
+    }
+
+    // remainder
+    FillDeltaR2Scalar(etaA, phiA, eta + iCst, phi + iCst, nCsts - iCst, dr2 + iCst);
+#else
+    FillDeltaR2Scalar(etaA, phiA, eta, phi, nCsts, dr2);
+#endif
+    return;
+
+  }  // end 'FillDeltaR2AVX2(double, double, double*, double*, size_t, double*)'
+
+
+
+#ifdef SCORRELATORUTILITIES_HAS_X86
+  __attribute__((target("avx512f")))
+#endif
+  void Tools::FillDeltaR2AVX512(
+    const double etaA,
+    const double phiA,
+    const double* eta,
+    const double* phi,
+    const size_t nCsts,
+    double* dr2
+  ) {
+
+#ifdef SCORRELATORUTILITIES_HAS_X86
+    const __m512d vEtaA  = _mm512_set1_pd(etaA);
+    const __m512d vPhiA  = _mm512_set1_pd(phiA);
+    const __m512d vTwoPi = _mm512_set1_pd(2. * M_PI);
+    const __m512i vAbs   = _mm512_set1_epi64(0x7FFFFFFFFFFFFFFF);
+
+    // 8 lanes at a time, with a masked tail
+    for (size_t iCst = 0; iCst < nCsts; iCst += 8) {
+      const size_t    nLeft = nCsts - iCst;
+      const __mmask8  mask  = (nLeft >= 8) ? (__mmask8) 0xFF : (__mmask8) ((1u << nLeft) - 1u);
+      const __m512d   dEta  = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, eta + iCst), vEtaA);
+      const __m512d   dPhiD = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, phi + iCst), vPhiA);
+      const __m512d   dPhiA = _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(dPhiD), vAbs));
+      const __m512d   dPhi  = _mm512_maskz_min_pd(mask, dPhiA, _mm512_sub_pd(vTwoPi, dPhiA));
+      _mm512_mask_storeu_pd(dr2 + iCst, mask, _mm512_add_pd(_mm512_mul_pd(dEta, dEta), _mm512_mul_pd(dPhi, dPhi)));
+    }
+#else
+    FillDeltaR2Scalar(etaA, phiA, eta, phi, nCsts, dr2);
+#endif
+    return;
+
+  }  // end 'FillDeltaR2AVX512(double, double, double*, double*, size_t, double*)'
+
+
+
+  void Tools::FillDeltaR2(
+    const double etaA,
+    const double phiA,
+    const double* eta,
+    const double* phi,
+    const size_t nCsts,
+    double* dr2,
+    const Const::Simd simd
+  ) {
+
+    switch (simd) {
+      case Const::Simd::AVX512:
+        FillDeltaR2AVX512(etaA, phiA, eta, phi, nCsts, dr2);
+        break;
+      case Const::Simd::AVX2:
+        FillDeltaR2AVX2(etaA, phiA, eta, phi, nCsts, dr2);
+        break;
+      default:
+        FillDeltaR2Scalar(etaA, phiA, eta, phi, nCsts, dr2);
+        break;
+    }
+    return;
+
+  }  // end 'FillDeltaR2(double, double, double*, double*, size_t, double*, Const::Simd)'
+
+
+
+  // two-point correlator -----------------------------------------------------
+
+  void Tools::EEC2Point(
+    const double* z,
+    const double* eta,
+    const double* phi,
+    const size_t nCsts,
+    Types::CorrHist1D& hist,
+    const Const::Simd simd
+  ) {
+
+    // resolve instruction set once per jet
+    const Const::Simd level = ResolveSimdLevel(simd);
+
+    // scratch row of squared distances, reused across calls
+    thread_local Types::AlignedVector<double> dr2;
+    if (dr2.size() < nCsts) dr2.resize(nCsts);
+
+    for (size_t iCstA = 0; iCstA + 1 < nCsts; ++iCstA) {
+
+      // distances to all later constituents in lanes
+      const size_t iCstB = iCstA + 1;
+      const size_t nRow  = nCsts - iCstB;
+      FillDeltaR2(eta[iCstA], phi[iCstA], eta + iCstB, phi + iCstB, nRow, dr2.data(), level);
+
+      // bin on squared distance, so no sqrt is needed
+      const double  zA = z[iCstA];
+      const double* zB = z + iCstB;
+      for (size_t iPair = 0; iPair < nRow; ++iPair) {
+        hist.FillSquared(dr2[iPair], zA * zB[iPair]);
+      }
+    }  // end constituent loop
+    return;
+
+  }  // end 'EEC2Point(double*, double*, double*, size_t, Types::CorrHist1D&, Const::Simd)'
+
+
+
+  void Tools::EEC2Point(
+    const Types::CstInfoSoA& csts,
+    const Types::CstInfoSoA::JetRange& jet,
+    Types::CorrHist1D& hist,
+    const Const::Simd simd
+  ) {
+
+    EEC2Point(
+      csts.z.data() + jet.begin,
+      csts.eta.data() + jet.begin,
+      csts.phi.data() + jet.begin,
+      jet.Size(),
+      hist,
+      simd
+    );
+    return;
+
+  }  // end 'EEC2Point(Types::CstInfoSoA&, Types::CstInfoSoA::JetRange&, Types::CorrHist1D&, Const::Simd)'
+
+
+
+  void Tools::EEC2Point(
+    const vector<Types::CstInfo>& csts,
+    Types::CorrHist1D& hist,
+    const Const::Simd simd
+  ) {
+
+    // gather hot columns into reusable scratch
+    thread_local Types::AlignedVector<double> z;
+    thread_local Types::AlignedVector<double> eta;
+    thread_local Types::AlignedVector<double> phi;
+
+    const size_t nCsts = csts.size();
+    z.resize(nCsts);
+    eta.resize(nCsts);
+    phi.resize(nCsts);
+    for (size_t iCst = 0; iCst < nCsts; ++iCst) {
+      z[iCst]   = csts[iCst].GetZ();
+      eta[iCst] = csts[iCst].GetEta();
+      phi[iCst] = csts[iCst].GetPhi();
+    }
+
+    EEC2Point(z.data(), eta.data(), phi.data(), nCsts, hist, simd);
+    return;
+
+  }  // end 'EEC2Point(vector<Types::CstInfo>&, Types::CorrHist1D&, Const::Simd)'
+
+
+
+  void Tools::EEC2PointReference(const vector<Types::CstInfo>& csts, Types::CorrHist1D& hist) {
+
+    for (size_t iCstA = 0; iCstA < csts.size(); ++iCstA) {
+      for (size_t iCstB = iCstA + 1; iCstB < csts.size(); ++iCstB) {
+
+        // wrap delta-phi into [0, pi]
+        const double dEta    = csts[iCstB].GetEta() - csts[iCstA].GetEta();
+        const double dPhiAbs = fabs(csts[iCstB].GetPhi() - csts[iCstA].GetPhi());
+        const double dPhi    = (dPhiAbs > M_PI) ? ((2. * M_PI) - dPhiAbs) : dPhiAbs;
+
+        hist.FillSquared((dEta * dEta) + (dPhi * dPhi), csts[iCstA].GetZ() * csts[iCstB].GetZ());
+      }
+    }
+    return;
+
+  }  // end 'EEC2PointReference(vector<Types::CstInfo>&, Types::CorrHist1D&)'
+
+
+
+  // projected n-point correlators --------------------------------------------
+
+  template <size_t N> void Tools::ProjectedENC(
+    const double* z,
+    const double* eta,
+    const double* phi,
+    const size_t nCsts,
+    Types::CorrHist1D& hist,
+    const Const::Simd simd
+  ) {
+
+    static_assert((N >= 2) && (N <= 4), "ProjectedENC is only implemented for N = 2, 3, 4");
+
+    // a constituent pair, keyed on squared distance
+    struct Pair {
+      double   dr2;
+      uint32_t a;
+      uint32_t b;
+    };
+
+    const Const::Simd level = ResolveSimdLevel(simd);
+    const size_t      nWord = (nCsts + 63) / 64;
+
+    // scratch reused across calls
+    thread_local vector<Pair>                 pairs;
+    thread_local vector<uint64_t>             adjacent;
+    thread_local Types::AlignedVector<double> dr2;
+    pairs.clear();
+    adjacent.assign(nCsts * nWord, 0);
+    if (dr2.size() < nCsts) dr2.resize(nCsts);
+
+    // build and sort all pair distances
+    for (size_t iCstA = 0; iCstA + 1 < nCsts; ++iCstA) {
+      const size_t iCstB = iCstA + 1;
+      const size_t nRow  = nCsts - iCstB;
+      FillDeltaR2(eta[iCstA], phi[iCstA], eta + iCstB, phi + iCstB, nRow, dr2.data(), level);
+      for (size_t iPair = 0; iPair < nRow; ++iPair) {
+        pairs.push_back({dr2[iPair], (uint32_t) iCstA, (uint32_t) (iCstB + iPair)});
+      }
+    }
+    sort(
+      pairs.begin(),
+      pairs.end(),
+      [](const Pair& lhs, const Pair& rhs) {return lhs.dr2 < rhs.dr2;}
+    );
+
+    // sum of z over the set bits of a bitset
+    auto sumOver = [&](const uint64_t* bits) {
+      double sum = 0.;
+      for (size_t iWord = 0; iWord < nWord; ++iWord) {
+        for (uint64_t word = bits[iWord]; word != 0; word &= (word - 1)) {
+          sum += z[(iWord * 64) + __builtin_ctzll(word)];
+        }
+      }
+      return sum;
+    };
+
+    // sweep pairs in increasing distance: when (a, b) is added, every
+    // tuple whose other pairs are already connected has (a, b) as its
+    // largest side, so each tuple is counted exactly once
+    thread_local vector<uint64_t> common;
+    common.resize(nWord);
+    for (const Pair& pair : pairs) {
+
+      const double    zA   = z[pair.a];
+      const double    zB   = z[pair.b];
+      const uint64_t* adjA = adjacent.data() + (pair.a * nWord);
+      const uint64_t* adjB = adjacent.data() + (pair.b * nWord);
+
+      double weight = 0.;
+      if constexpr (N == 2) {
+        weight = 2. * zA * zB;
+      } else {
+
+        // constituents already within range of both a and b
+        for (size_t iWord = 0; iWord < nWord; ++iWord) {
+          common[iWord] = adjA[iWord] & adjB[iWord];
+        }
+        const double sumC = sumOver(common.data());
+
+        if constexpr (N == 3) {
+          weight = (3. * zA * zB * (zA + zB)) + (6. * zA * zB * sumC);
+        } else {
+
+          // sum of z_c * z_d over connected c, d in common (both orders)
+          double sumCD = 0.;
+          double sumC2 = 0.;
+          for (size_t iWord = 0; iWord < nWord; ++iWord) {
+            for (uint64_t word = common[iWord]; word != 0; word &= (word - 1)) {
+              const size_t    iCstC = (iWord * 64) + __builtin_ctzll(word);
+              const uint64_t* adjC  = adjacent.data() + (iCstC * nWord);
+              double          sumD  = 0.;
+              for (size_t jWord = 0; jWord < nWord; ++jWord) {
+                for (uint64_t both = common[jWord] & adjC[jWord]; both != 0; both &= (both - 1)) {
+                  sumD += z[(jWord * 64) + __builtin_ctzll(both)];
+                }
+              }
+              sumCD += z[iCstC] * sumD;
+              sumC2 += z[iCstC] * z[iCstC];
+            }
+          }
+
+          const double zAB = zA * zB;
+          weight  = zAB * ((4. * zA * zA) + (6. * zA * zB) + (4. * zB * zB));
+          weight += 12. * zAB * (((zA + zB) * sumC) + sumC2);
+          weight += 12. * zAB * sumCD;
+        }
+      }
+      hist.FillSquared(pair.dr2, weight);
+
+      // now connect a and b
+      adjacent[(pair.a * nWord) + (pair.b / 64)] |= (uint64_t) 1 << (pair.b % 64);
+      adjacent[(pair.b * nWord) + (pair.a / 64)] |= (uint64_t) 1 << (pair.a % 64);
+    }  // end pair loop
+    return;
+
+  }  // end 'ProjectedENC<N>(double*, double*, double*, size_t, Types::CorrHist1D&, Const::Simd)'
+
+
+
+  template <size_t N> void Tools::ProjectedENC(
+    const Types::CstInfoSoA& csts,
+    const Types::CstInfoSoA::JetRange& jet,
+    Types::CorrHist1D& hist,
+    const Const::Simd simd
+  ) {
+
+    ProjectedENC<N>(
+      csts.z.data() + jet.begin,
+      csts.eta.data() + jet.begin,
+      csts.phi.data() + jet.begin,
+      jet.Size(),
+      hist,
+      simd
+    );
+    return;
+
+  }  // end 'ProjectedENC<N>(Types::CstInfoSoA&, Types::CstInfoSoA::JetRange&, Types::CorrHist1D&, Const::Simd)'
+
+
+
+  template <size_t N> void Tools::ProjectedENC(
+    const vector<Types::CstInfo>& csts,
+    Types::CorrHist1D& hist,
+    const Const::Simd simd
+  ) {
+
+    // gather hot columns into reusable scratch
+    thread_local Types::AlignedVector<double> z;
+    thread_local Types::AlignedVector<double> eta;
+    thread_local Types::AlignedVector<double> phi;
+
+    const size_t nCsts = csts.size();
+    z.resize(nCsts);
+    eta.resize(nCsts);
+    phi.resize(nCsts);
+    for (size_t iCst = 0; iCst < nCsts; ++iCst) {
+      z[iCst]   = csts[iCst].GetZ();
+      eta[iCst] = csts[iCst].GetEta();
+      phi[iCst] = csts[iCst].GetPhi();
+    }
+
+    ProjectedENC<N>(z.data(), eta.data(), phi.data(), nCsts, hist, simd);
+    return;
+
+  }  // end 'ProjectedENC<N>(vector<Types::CstInfo>&, Types::CorrHist1D&, Const::Simd)'
+
+
+
+  template <size_t N> void Tools::ProjectedENCReference(const vector<Types::CstInfo>& csts, Types::CorrHist1D& hist) {
+
+    // nothing to correlate in an empty jet
+    const size_t nCsts = csts.size();
+    if (nCsts == 0) return;
+
+    // squared distance between two constituents
+    auto getDR2 = [&](const size_t iCstA, const size_t iCstB) {
+      const double dEta    = csts[iCstB].GetEta() - csts[iCstA].GetEta();
+      const double dPhiAbs = fabs(csts[iCstB].GetPhi() - csts[iCstA].GetPhi());
+      const double dPhi    = (dPhiAbs > M_PI) ? ((2. * M_PI) - dPhiAbs) : dPhiAbs;
+      return (dEta * dEta) + (dPhi * dPhi);
+    };
+
+    // loop over all ordered N-tuples
+    array<size_t, N> index;
+    index.fill(0);
+    while (true) {
+
+      double weight = 1.;
+      double maxDR2 = 0.;
+      bool   isSelf = true;
+      for (size_t iIdx = 0; iIdx < N; ++iIdx) {
+        weight *= csts[index[iIdx]].GetZ();
+        isSelf &= (index[iIdx] == index[0]);
+        for (size_t jIdx = iIdx + 1; jIdx < N; ++jIdx) {
+          if (index[iIdx] != index[jIdx]) {
+            maxDR2 = max(maxDR2, getDR2(index[iIdx], index[jIdx]));
+          }
+        }
+      }
+      if (!isSelf) hist.FillSquared(maxDR2, weight);
+
+      // advance to next tuple
+      size_t iIdx = 0;
+      while ((iIdx < N) && (++index[iIdx] == nCsts)) {
+        index[iIdx] = 0;
+        ++iIdx;
+      }
+      if (iIdx == N) break;
+    }
+    return;
+
+  }  // end 'ProjectedENCReference<N>(vector<Types::CstInfo>&, Types::CorrHist1D&)'
+
+
+
+  // histogram fill benchmark -----------------------------------------------
+
+  vector<Tools::HistFillTiming> Tools::BenchmarkHistFill(
+    const Types::CorrHist3D& prototype,
+    const vector<size_t>& nThreads,
+    const size_t nFillsPerThread,
+    const uint64_t seed
+  ) {
+
+    // run a job on nThread threads and return the wall time
+    auto timeJob = [](const size_t nThread, const function<void(size_t)>& job) {
+      const auto start = chrono::steady_clock::now();
+
+      vector<thread> threads;
+      for (size_t iThread = 0; iThread < nThread; ++iThread) {
+        threads.emplace_back(job, iThread);
+      }
+      for (thread& worker : threads) {
+        worker.join();
+      }
+      return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    };
+
+    const size_t nBins    = prototype.GetContent().size();
+    const double logMin   = log(prototype.GetXAxis().GetMin());
+    const double logRange = log(prototype.GetXAxis().GetMax()) - logMin;
+
+    vector<HistFillTiming> timings;
+    for (const size_t nThread : nThreads) {
+
+      // generate inputs up front so only the fills are timed
+      vector<vector<array<double, 4>>> inputs(nThread);
+      for (size_t iThread = 0; iThread < nThread; ++iThread) {
+        mt19937_64                        rng(seed + iThread);
+        uniform_real_distribution<double> unit(0., 1.);
+
+        inputs[iThread].resize(nFillsPerThread);
+        for (array<double, 4>& input : inputs[iThread]) {
+          input[0] = exp(logMin + (logRange * unit(rng)));
+          input[1] = unit(rng);
+          input[2] = (M_PI / 2.) * unit(rng);
+          input[3] = unit(rng) * unit(rng) * unit(rng);
+        }
+      }
+
+      HistFillTiming timing;
+      timing.nThreads = nThread;
+
+      // per-thread shards, merged at the end
+      Types::CorrHistShards<Types::CorrHist3D> shards(prototype, nThread);
+      Types::CorrHist3D                        sharded;
+      timing.bytesSharded = nThread * (sizeof(Types::CorrHist3D) + (nBins * 2 * sizeof(double)));
+      timing.secSharded = timeJob(
+        nThread,
+        [&](const size_t iThread) {
+          Types::CorrHist3D& shard = shards.GetShard(iThread);
+          for (const array<double, 4>& input : inputs[iThread]) {
+            shard.Fill(input[0], input[1], input[2], input[3]);
+          }
+        }
+      );
+      const auto startMerge = chrono::steady_clock::now();
+      sharded = shards.Merge();
+      timing.secSharded += chrono::duration<double>(chrono::steady_clock::now() - startMerge).count();
+
+      // shared atomic bins
+      Types::ConcurrentHist<Types::CorrHist3D> atomicHist(prototype);
+      timing.bytesAtomic = atomicHist.GetNBytes();
+      timing.secAtomic = timeJob(
+        nThread,
+        [&](const size_t iThread) {
+          for (const array<double, 4>& input : inputs[iThread]) {
+            atomicHist.Fill(input[0], input[1], input[2], input[3]);
+          }
+        }
+      );
+
+      // shared atomic bins behind write-combining buffers
+      Types::ConcurrentHist<Types::CorrHist3D> bufferedHist(prototype);
+      vector<size_t>                           bufferBytes(nThread, 0);
+      timing.secBuffered = timeJob(
+        nThread,
+        [&](const size_t iThread) {
+          Types::ConcurrentHist<Types::CorrHist3D>::Buffer buffer(bufferedHist);
+          bufferBytes[iThread] = buffer.GetNBytes();
+          for (const array<double, 4>& input : inputs[iThread]) {
+            buffer.FillBin(prototype.FindGlobalBin(input[0], input[1], input[2]), input[3]);
+          }
+        }
+      );
+
+      timing.bytesBuffered = bufferedHist.GetNBytes();
+      for (const size_t bytes : bufferBytes) {
+        timing.bytesBuffered += bytes;
+      }
+
+      // sums only differ by the order of additions
+      const Types::CorrHist3D fromAtomic = atomicHist.GetHist();
+      for (size_t iBin = 0; iBin < nBins; ++iBin) {
+        const double ref  = sharded.GetContent()[iBin];
+        const double diff = fabs(fromAtomic.GetContent()[iBin] - ref);
+        if (ref != 0.) {
+          timing.maxRelDiff = max(timing.maxRelDiff, diff / fabs(ref));
+        }
+      }
+      timings.push_back(timing);
+    }  // end thread count loop
+    return timings;
+
+  }  // end 'BenchmarkHistFill(Types::CorrHist3D&, vector<size_t>&, size_t, uint64_t)'
+
+
+
+  // explicit instantiations
+  template void Tools::ProjectedENC<2>(const double*, const double*, const double*, const size_t, Types::CorrHist1D&, const Const::Simd);
+  template void Tools::ProjectedENC<3>(const double*, const double*, const double*, const size_t, Types::CorrHist1D&, const Const::Simd);
+  template void Tools::ProjectedENC<4>(const double*, const double*, const double*, const size_t, Types::CorrHist1D&, const Const::Simd);
+  template void Tools::ProjectedENC<2>(const Types::CstInfoSoA&, const Types::CstInfoSoA::JetRange&, Types::CorrHist1D&, const Const::Simd);
+  template void Tools::ProjectedENC<3>(const Types::CstInfoSoA&, const Types::CstInfoSoA::JetRange&, Types::CorrHist1D&, const Const::Simd);
+  template void Tools::ProjectedENC<4>(const Types::CstInfoSoA&, const Types::CstInfoSoA::JetRange&, Types::CorrHist1D&, const Const::Simd);
+  template void Tools::ProjectedENC<2>(const vector<Types::CstInfo>&, Types::CorrHist1D&, const Const::Simd);
+  template void Tools::ProjectedENC<3>(const vector<Types::CstInfo>&, Types::CorrHist1D&, const Const::Simd);
+  template void Tools::ProjectedENC<4>(const vector<Types::CstInfo>&, Types::CorrHist1D&, const Const::Simd);
+  template void Tools::ProjectedENCReference<2>(const vector<Types::CstInfo>&, Types::CorrHist1D&);
+  template void Tools::ProjectedENCReference<3>(const vector<Types::CstInfo>&, Types::CorrHist1D&);
+  template void Tools::ProjectedENCReference<4>(const vector<Types::CstInfo>&, Types::CorrHist1D&);
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
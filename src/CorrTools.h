@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// 'CorrTools.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Collection of correlator kernels utilized in the
+// sPHENIX Cold QCD Energy-Energy Correlator analysis.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CORRTOOLS_H
+#define SCORRELATORUTILITIES_CORRTOOLS_H
+
+// c++ utilities
+#include <array>
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+// analysis utilities
+#include "CstInfo.h"
+#include "CorrHist.h"
+#include "ConcurrentHist.h"
+#include "Constants.h"
+#include "CstInfoSoA.h"
+#include "AlignedAllocator.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Tools {
+
+    // simd dispatch ----------------------------------------------------------
+
+    Const::Simd GetSimdLevel();
+    Const::Simd ResolveSimdLevel(const Const::Simd request);
+
+
+
+    // pair-distance kernels --------------------------------------------------
+
+    // n.b. these fill dr2[j] = (eta[j] - etaA)^2 + (phi[j] - phiA)^2 with
+    // delta-phi wrapped into [0, pi], for phi in [-pi, pi) or [0, 2pi)
+    void FillDeltaR2Scalar(const double etaA, const double phiA, const double* eta, const double* phi, const size_t nCsts, double* dr2);
+    void FillDeltaR2AVX2(const double etaA, const double phiA, const double* eta, const double* phi, const size_t nCsts, double* dr2);
+    void FillDeltaR2AVX512(const double etaA, const double phiA, const double* eta, const double* phi, const size_t nCsts, double* dr2);
+    void FillDeltaR2(const double etaA, const double phiA, const double* eta, const double* phi, const size_t nCsts, double* dr2, const Const::Simd simd);
+
+
+
+    // two-point correlator ---------------------------------------------------
+
+    // n.b. each unique pair (i < j) is filled once with weight z_i * z_j
+    void EEC2Point(
+      const double* z,
+      const double* eta,
+      const double* phi,
+      const size_t nCsts,
+      Types::CorrHist1D& hist,
+      const Const::Simd simd = Const::Simd::Auto
+    );
+    void EEC2Point(
+      const Types::CstInfoSoA& csts,
+      const Types::CstInfoSoA::JetRange& jet,
+      Types::CorrHist1D& hist,
+      const Const::Simd simd = Const::Simd::Auto
+    );
+    void EEC2Point(
+      const vector<Types::CstInfo>& csts,
+      Types::CorrHist1D& hist,
+      const Const::Simd simd = Const::Simd::Auto
+    );
+
+    // scalar reference for validation
+    void EEC2PointReference(const vector<Types::CstInfo>& csts, Types::CorrHist1D& hist);
+
+
+
+    // projected n-point correlators ------------------------------------------
+
+    // n.b. sums z_i1 * ... * z_iN over all ordered N-tuples (repeated
+    // indices included, pure self-terms excluded) at the largest pairwise
+    // distance in the tuple, so ProjectedENC<2> = 2 * EEC2Point
+    template <size_t N> void ProjectedENC(
+      const double* z,
+      const double* eta,
+      const double* phi,
+      const size_t nCsts,
+      Types::CorrHist1D& hist,
+      const Const::Simd simd = Const::Simd::Auto
+    );
+    template <size_t N> void ProjectedENC(
+      const Types::CstInfoSoA& csts,
+      const Types::CstInfoSoA::JetRange& jet,
+      Types::CorrHist1D& hist,
+      const Const::Simd simd = Const::Simd::Auto
+    );
+    template <size_t N> void ProjectedENC(
+      const vector<Types::CstInfo>& csts,
+      Types::CorrHist1D& hist,
+      const Const::Simd simd = Const::Simd::Auto
+    );
+
+    // brute-force reference for validation
+    template <size_t N> void ProjectedENCReference(const vector<Types::CstInfo>& csts, Types::CorrHist1D& hist);
+
+
+
+    // histogram fill benchmark -----------------------------------------------
+
+    // timing (in seconds) and memory (in bytes) of filling one histogram
+    // from several threads via per-thread shards, shared atomic bins,
+    // and shared atomic bins behind write-combining buffers
+    struct HistFillTiming {
+      size_t nThreads      = 0;
+      double secSharded    = 0.;
+      double secAtomic     = 0.;
+      double secBuffered   = 0.;
+      size_t bytesSharded  = 0;
+      size_t bytesAtomic   = 0;
+      size_t bytesBuffered = 0;
+      double maxRelDiff    = 0.;
+    };
+
+    // n.b. every mode fills the same random E3C-like (RL, xi, phi) entries,
+    // and maxRelDiff compares the atomic result to the sharded one; byte
+    // counts are everything a mode allocates, including per-thread buffers
+    vector<HistFillTiming> BenchmarkHistFill(
+      const Types::CorrHist3D& prototype,
+      const vector<size_t>& nThreads,
+      const size_t nFillsPerThread = 1000000,
+      const uint64_t seed = 12345
+    );
+
+  }  // end Tools namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -158,6 +158,32 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  vector<Types::MemberLayout> Types::CstInfo::GetMemberLayout() {
+
+    // n.b. same order and names as GetListOfMembers()
+    vector<MemberLayout> layout = {
+      {"type",    offsetof(CstInfo, type),    Const::Leaf::Int},
+      {"cstID",   offsetof(CstInfo, cstID),   Const::Leaf::Int},
+      {"jetID",   offsetof(CstInfo, jetID),   Const::Leaf::Int},
+      {"embedID", offsetof(CstInfo, embedID), Const::Leaf::Int},
+      {"pid",     offsetof(CstInfo, pid),     Const::Leaf::Int},
+      {"z",       offsetof(CstInfo, z),       Const::Leaf::Double},
+      {"dr",      offsetof(CstInfo, dr),      Const::Leaf::Double},
+      {"jt",      offsetof(CstInfo, jt),      Const::Leaf::Double},
+      {"ene",     offsetof(CstInfo, ene),     Const::Leaf::Double},
+      {"px",      offsetof(CstInfo, px),      Const::Leaf::Double},
+      {"py",      offsetof(CstInfo, py),      Const::Leaf::Double},
+      {"pz",      offsetof(CstInfo, pz),      Const::Leaf::Double},
+      {"pt",      offsetof(CstInfo, pt),      Const::Leaf::Double},
+      {"eta",     offsetof(CstInfo, eta),     Const::Leaf::Double},
+      {"phi",     offsetof(CstInfo, phi),     Const::Leaf::Double}
+    };
+    return layout;
+
+  }  // end 'GetMemberLayout()'
+
+
+
   // overloaded operators -----------------------------------------------------
 
   bool Types::operator <(const CstInfo& lhs, const CstInfo& rhs) {
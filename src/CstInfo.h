@@ -25,6 +25,7 @@
 // analysis utilities
 #include "JetInfo.h"
 #include "Constants.h"
+#include "MemberLayout.h"
 
 // make common namespaces implicit
 using namespace std;
@@ -105,7 +106,8 @@ namespace SColdQcdCorrelatorAnalysis {
         bool IsInAcceptance(const pair<CstInfo, CstInfo>& range) const;
 
         // static methods
-        static vector<string> GetListOfMembers();
+        static vector<string>       GetListOfMembers();
+        static vector<MemberLayout> GetMemberLayout();
 
         // overloaded operators
         friend bool operator <(const CstInfo& lhs, const CstInfo& rhs);
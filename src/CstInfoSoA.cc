@@ -0,0 +1,281 @@
+// ----------------------------------------------------------------------------
+// 'CstInfoSoA.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Structure-of-arrays container for jet constituents,
+// flattening all jets in an event into contiguous columns
+// with per-jet offset ranges.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CSTINFOSOA_CC
+
+// class definition
+#include "CstInfoSoA.h"
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // container methods --------------------------------------------------------
+
+  void Types::CstInfoSoA::Clear() {
+
+    // n.b. clear() keeps capacity, so refilling doesn't reallocate
+    type.clear();
+    cstID.clear();
+    jetID.clear();
+    embedID.clear();
+    pid.clear();
+    z.clear();
+    dr.clear();
+    jt.clear();
+    ene.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    pt.clear();
+    eta.clear();
+    phi.clear();
+    offsets.resize(1);
+    offsets[0] = 0;
+    return;
+
+  }  // end 'Clear()'
+
+
+
+  void Types::CstInfoSoA::Reserve(const size_t nCsts, const size_t nJets) {
+
+    type.reserve(nCsts);
+    cstID.reserve(nCsts);
+    jetID.reserve(nCsts);
+    embedID.reserve(nCsts);
+    pid.reserve(nCsts);
+    z.reserve(nCsts);
+    dr.reserve(nCsts);
+    jt.reserve(nCsts);
+    ene.reserve(nCsts);
+    px.reserve(nCsts);
+    py.reserve(nCsts);
+    pz.reserve(nCsts);
+    pt.reserve(nCsts);
+    eta.reserve(nCsts);
+    phi.reserve(nCsts);
+    offsets.reserve(nJets + 1);
+    return;
+
+  }  // end 'Reserve(size_t, size_t)'
+
+
+
+  void Types::CstInfoSoA::Push(const CstInfo& info) {
+
+    type   .push_back(info.GetType());
+    cstID  .push_back(info.GetCstID());
+    jetID  .push_back(info.GetJetID());
+    embedID.push_back(info.GetEmbedID());
+    pid    .push_back(info.GetPID());
+    z      .push_back(info.GetZ());
+    dr     .push_back(info.GetDR());
+    jt     .push_back(info.GetJT());
+    ene    .push_back(info.GetEne());
+    px     .push_back(info.GetPX());
+    py     .push_back(info.GetPY());
+    pz     .push_back(info.GetPZ());
+    pt     .push_back(info.GetPT());
+    eta    .push_back(info.GetEta());
+    phi    .push_back(info.GetPhi());
+    return;
+
+  }  // end 'Push(CstInfo&)'
+
+
+
+  void Types::CstInfoSoA::CloseJet() {
+
+    offsets.push_back(Size());
+    return;
+
+  }  // end 'CloseJet()'
+
+
+
+  Types::CstInfo Types::CstInfoSoA::GetInfo(const size_t index) const {
+
+    CstInfo info;
+    info.SetType(type[index]);
+    info.SetCstID(cstID[index]);
+    info.SetJetID(jetID[index]);
+    info.SetEmbedID(embedID[index]);
+    info.SetPID(pid[index]);
+    info.SetZ(z[index]);
+    info.SetDR(dr[index]);
+    info.SetJT(jt[index]);
+    info.SetEne(ene[index]);
+    info.SetPX(px[index]);
+    info.SetPY(py[index]);
+    info.SetPZ(pz[index]);
+    info.SetPT(pt[index]);
+    info.SetEta(eta[index]);
+    info.SetPhi(phi[index]);
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  // fill methods -------------------------------------------------------------
+
+  void Types::CstInfoSoA::Fill(const vector<vector<CstInfo>>& jets) {
+
+    // count constituents so columns grow at most once
+    size_t nCsts = 0;
+    for (const vector<CstInfo>& csts : jets) {
+      nCsts += csts.size();
+    }
+
+    Clear();
+    Reserve(nCsts, jets.size());
+    for (const vector<CstInfo>& csts : jets) {
+      AddJet(csts);
+    }
+    return;
+
+  }  // end 'Fill(vector<vector<CstInfo>>&)'
+
+
+
+  void Types::CstInfoSoA::AddJet(const vector<CstInfo>& csts) {
+
+    for (const CstInfo& cst : csts) {
+      Push(cst);
+    }
+    CloseJet();
+    return;
+
+  }  // end 'AddJet(vector<CstInfo>&)'
+
+
+
+  void Types::CstInfoSoA::AddJet(const JetInfo& jet, const vector<fastjet::PseudoJet>& csts) {
+
+    // jet 3-momentum
+    const double pxJet   = jet.GetPX();
+    const double pyJet   = jet.GetPY();
+    const double pzJet   = jet.GetPZ();
+    const double pJet2   = (pxJet * pxJet) + (pyJet * pyJet) + (pzJet * pzJet);
+    const int    invalid = numeric_limits<int>::max();
+
+    // n.b. z, dr, and jt follow CstInfo::SetJetInfo
+    for (const fastjet::PseudoJet& cst : csts) {
+
+      const double pxCst  = cst.px();
+      const double pyCst  = cst.py();
+      const double pzCst  = cst.pz();
+      const double etaCst = cst.pseudorapidity();
+      const double phiCst = cst.phi_std();
+
+      // cross product of constituent and jet momenta
+      const double xCross = (pyCst * pzJet) - (pzCst * pyJet);
+      const double yCross = (pzCst * pxJet) - (pxCst * pzJet);
+      const double zCross = (pxCst * pyJet) - (pyCst * pxJet);
+
+      const double dEta = etaCst - jet.GetEta();
+      const double dPhi = phiCst - jet.GetPhi();
+
+      type.push_back(invalid);
+      cstID.push_back(cst.user_index());
+      jetID.push_back((int) jet.GetJetID());
+      embedID.push_back(invalid);
+      pid.push_back(invalid);
+      z.push_back(((pxCst * pxJet) + (pyCst * pyJet) + (pzCst * pzJet)) / pJet2);
+      dr.push_back(sqrt((dEta * dEta) + (dPhi * dPhi)));
+      jt.push_back(sqrt((xCross * xCross) + (yCross * yCross) + (zCross * zCross)) / pJet2);
+      ene.push_back(cst.E());
+      px.push_back(pxCst);
+      py.push_back(pyCst);
+      pz.push_back(pzCst);
+      pt.push_back(cst.perp());
+      eta.push_back(etaCst);
+      phi.push_back(phiCst);
+    }
+    CloseJet();
+    return;
+
+  }  // end 'AddJet(JetInfo&, vector<fastjet::PseudoJet>&)'
+
+
+
+  void Types::CstInfoSoA::AddJet(const fastjet::PseudoJet& jet, const vector<fastjet::PseudoJet>& csts, const uint32_t id) {
+
+    JetInfo info;
+    info.SetJetID( id );
+    info.SetPX( jet.px() );
+    info.SetPY( jet.py() );
+    info.SetPZ( jet.pz() );
+    info.SetEta( jet.pseudorapidity() );
+    info.SetPhi( jet.phi_std() );
+
+    AddJet(info, csts);
+    return;
+
+  }  // end 'AddJet(fastjet::PseudoJet&, vector<fastjet::PseudoJet>&, uint32_t)'
+
+
+
+  void Types::CstInfoSoA::Fill(const vector<fastjet::PseudoJet>& jets) {
+
+    // n.b. PseudoJet::constituents() returns by value, so grab each
+    // list once and use it both to count and to fill
+    thread_local vector<vector<fastjet::PseudoJet>> cstLists;
+    cstLists.resize(jets.size());
+
+    size_t nCsts = 0;
+    for (size_t iJet = 0; iJet < jets.size(); ++iJet) {
+      cstLists[iJet] = jets[iJet].constituents();
+      nCsts         += cstLists[iJet].size();
+    }
+
+    // n.b. jet ids are the jets' positions in the input
+    Clear();
+    Reserve(nCsts, jets.size());
+    for (size_t iJet = 0; iJet < jets.size(); ++iJet) {
+      AddJet(jets[iJet], cstLists[iJet], (uint32_t) iJet);
+    }
+    return;
+
+  }  // end 'Fill(vector<fastjet::PseudoJet>&)'
+
+
+
+  // ctor/dtor ----------------------------------------------------------------
+
+  Types::CstInfoSoA::CstInfoSoA() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::CstInfoSoA::~CstInfoSoA() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::CstInfoSoA::CstInfoSoA(const vector<vector<CstInfo>>& jets) {
+
+    Fill(jets);
+
+  }  // end ctor(vector<vector<CstInfo>>&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
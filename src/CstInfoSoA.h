@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// 'CstInfoSoA.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Structure-of-arrays container for jet constituents,
+// flattening all jets in an event into contiguous columns
+// with per-jet offset ranges.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CSTINFOSOA_H
+#define SCORRELATORUTILITIES_CSTINFOSOA_H
+
+// c++ utilities
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+// fastjet libraries
+#include <fastjet/PseudoJet.hh>
+// analysis utilities
+#include "CstInfo.h"
+#include "JetInfo.h"
+#include "AlignedAllocator.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // CstInfoSoA definition --------------------------------------------------
+
+    struct CstInfoSoA {
+
+      // [begin, end) range of a jet's constituents
+      struct JetRange {
+        size_t begin = 0;
+        size_t end   = 0;
+        size_t Size() const {return end - begin;}
+      };
+
+      // proxy view of a single row
+      class Row {
+
+        private:
+
+          // data members
+          const CstInfoSoA* soa   = NULL;
+          size_t            index = 0;
+
+        public:
+
+          // getters
+          int    GetType() const    {return soa -> type[index];}
+          int    GetCstID() const   {return soa -> cstID[index];}
+          int    GetJetID() const   {return soa -> jetID[index];}
+          int    GetEmbedID() const {return soa -> embedID[index];}
+          int    GetPID() const     {return soa -> pid[index];}
+          double GetZ() const       {return soa -> z[index];}
+          double GetDR() const      {return soa -> dr[index];}
+          double GetJT() const      {return soa -> jt[index];}
+          double GetEne() const     {return soa -> ene[index];}
+          double GetPX() const      {return soa -> px[index];}
+          double GetPY() const      {return soa -> py[index];}
+          double GetPZ() const      {return soa -> pz[index];}
+          double GetPT() const      {return soa -> pt[index];}
+          double GetEta() const     {return soa -> eta[index];}
+          double GetPhi() const     {return soa -> phi[index];}
+
+          // convert row back into a CstInfo
+          CstInfo ToInfo() const {return soa -> GetInfo(index);}
+
+          // ctor
+          Row(const CstInfoSoA* arg_soa, const size_t arg_index) : soa(arg_soa), index(arg_index) {}
+
+      };  // end Row definition
+
+      // columns
+      AlignedVector<int>    type;
+      AlignedVector<int>    cstID;
+      AlignedVector<int>    jetID;
+      AlignedVector<int>    embedID;
+      AlignedVector<int>    pid;
+      AlignedVector<double> z;
+      AlignedVector<double> dr;
+      AlignedVector<double> jt;
+      AlignedVector<double> ene;
+      AlignedVector<double> px;
+      AlignedVector<double> py;
+      AlignedVector<double> pz;
+      AlignedVector<double> pt;
+      AlignedVector<double> eta;
+      AlignedVector<double> phi;
+
+      // per-jet offsets: jet i spans [offsets[i], offsets[i + 1])
+      vector<size_t> offsets = {0};
+
+      // container methods
+      void     Clear();
+      void     Reserve(const size_t nCsts, const size_t nJets);
+      void     Push(const CstInfo& info);
+      void     CloseJet();
+      size_t   Size()     const {return z.size();}
+      size_t   GetNJets() const {return offsets.size() - 1;}
+      JetRange GetJet(const size_t iJet) const {return {offsets[iJet], offsets[iJet + 1]};}
+      Row      operator[](const size_t index) const {return Row(this, index);}
+      CstInfo  GetInfo(const size_t index) const;
+
+      // fill methods
+      void Fill(const vector<vector<CstInfo>>& jets);
+      void AddJet(const vector<CstInfo>& csts);
+      void AddJet(const JetInfo& jet, const vector<fastjet::PseudoJet>& csts);
+      void AddJet(const fastjet::PseudoJet& jet, const vector<fastjet::PseudoJet>& csts, const uint32_t id);
+      void Fill(const vector<fastjet::PseudoJet>& jets);
+
+      // default ctor/dtor
+      CstInfoSoA();
+      ~CstInfoSoA();
+
+      // ctor accepting arguments
+      CstInfoSoA(const vector<vector<CstInfo>>& jets);
+
+    };  // end CstInfoSoA definition
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
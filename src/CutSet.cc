@@ -0,0 +1,269 @@
+// ----------------------------------------------------------------------------
+// 'CutSet.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Utility class to compile a (minimum, maximum) pair of
+// info objects down to the list of fields which are
+// actually bounded.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_CUTSET_CC
+
+// class definition
+#include "CutSet.h"
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // field lists --------------------------------------------------------------
+
+  // n.b. these mirror the fields used in each type's comparison operators
+
+  template <> const vector<Types::CutSet<Types::ClustInfo>::Field>& Types::CutSet<Types::ClustInfo>::GetListOfCutFields() {
+
+    static const vector<Field> fields = {
+      {"nTwr", [](const ClustInfo& info) -> double {return info.GetNTwr();}},
+      {"ene",  [](const ClustInfo& info) -> double {return info.GetEne(); }},
+      {"rho",  [](const ClustInfo& info) -> double {return info.GetRho(); }},
+      {"eta",  [](const ClustInfo& info) -> double {return info.GetEta(); }},
+      {"phi",  [](const ClustInfo& info) -> double {return info.GetPhi(); }},
+      {"px",   [](const ClustInfo& info) -> double {return info.GetPX();  }},
+      {"py",   [](const ClustInfo& info) -> double {return info.GetPY();  }},
+      {"pz",   [](const ClustInfo& info) -> double {return info.GetPZ();  }},
+      {"rx",   [](const ClustInfo& info) -> double {return info.GetRX();  }},
+      {"ry",   [](const ClustInfo& info) -> double {return info.GetRY();  }},
+      {"rz",   [](const ClustInfo& info) -> double {return info.GetRZ();  }}
+    };
+    return fields;
+
+  }  // end 'GetListOfCutFields()'
+
+
+
+  template <> const vector<Types::CutSet<Types::CstInfo>::Field>& Types::CutSet<Types::CstInfo>::GetListOfCutFields() {
+
+    static const vector<Field> fields = {
+      {"z",   [](const CstInfo& info) -> double {return info.GetZ();  }},
+      {"dr",  [](const CstInfo& info) -> double {return info.GetDR(); }},
+      {"jt",  [](const CstInfo& info) -> double {return info.GetJT(); }},
+      {"ene", [](const CstInfo& info) -> double {return info.GetEne();}},
+      {"px",  [](const CstInfo& info) -> double {return info.GetPX(); }},
+      {"py",  [](const CstInfo& info) -> double {return info.GetPY(); }},
+      {"pz",  [](const CstInfo& info) -> double {return info.GetPZ(); }},
+      {"pt",  [](const CstInfo& info) -> double {return info.GetPT(); }},
+      {"eta", [](const CstInfo& info) -> double {return info.GetEta();}},
+      {"phi", [](const CstInfo& info) -> double {return info.GetPhi();}}
+    };
+    return fields;
+
+  }  // end 'GetListOfCutFields()'
+
+
+
+  template <> const vector<Types::CutSet<Types::FlowInfo>::Field>& Types::CutSet<Types::FlowInfo>::GetListOfCutFields() {
+
+    static const vector<Field> fields = {
+      {"mass", [](const FlowInfo& info) -> double {return info.GetMass();}},
+      {"ene",  [](const FlowInfo& info) -> double {return info.GetEne(); }},
+      {"eta",  [](const FlowInfo& info) -> double {return info.GetEta(); }},
+      {"phi",  [](const FlowInfo& info) -> double {return info.GetPhi(); }},
+      {"px",   [](const FlowInfo& info) -> double {return info.GetPX();  }},
+      {"py",   [](const FlowInfo& info) -> double {return info.GetPY();  }},
+      {"pz",   [](const FlowInfo& info) -> double {return info.GetPZ();  }},
+      {"pt",   [](const FlowInfo& info) -> double {return info.GetPT();  }}
+    };
+    return fields;
+
+  }  // end 'GetListOfCutFields()'
+
+
+
+  template <> const vector<Types::CutSet<Types::JetInfo>::Field>& Types::CutSet<Types::JetInfo>::GetListOfCutFields() {
+
+    static const vector<Field> fields = {
+      {"nCsts", [](const JetInfo& info) -> double {return info.GetNCsts();}},
+      {"ene",   [](const JetInfo& info) -> double {return info.GetEne();  }},
+      {"px",    [](const JetInfo& info) -> double {return info.GetPX();   }},
+      {"py",    [](const JetInfo& info) -> double {return info.GetPY();   }},
+      {"pz",    [](const JetInfo& info) -> double {return info.GetPZ();   }},
+      {"pt",    [](const JetInfo& info) -> double {return info.GetPT();   }},
+      {"eta",   [](const JetInfo& info) -> double {return info.GetEta();  }},
+      {"phi",   [](const JetInfo& info) -> double {return info.GetPhi();  }},
+      {"area",  [](const JetInfo& info) -> double {return info.GetArea(); }}
+    };
+    return fields;
+
+  }  // end 'GetListOfCutFields()'
+
+
+
+  template <> const vector<Types::CutSet<Types::ParInfo>::Field>& Types::CutSet<Types::ParInfo>::GetListOfCutFields() {
+
+    static const vector<Field> fields = {
+      {"eta", [](const ParInfo& info) -> double {return info.GetEta();}},
+      {"phi", [](const ParInfo& info) -> double {return info.GetPhi();}},
+      {"ene", [](const ParInfo& info) -> double {return info.GetEne();}},
+      {"px",  [](const ParInfo& info) -> double {return info.GetPX(); }},
+      {"py",  [](const ParInfo& info) -> double {return info.GetPY(); }},
+      {"pz",  [](const ParInfo& info) -> double {return info.GetPZ(); }},
+      {"pt",  [](const ParInfo& info) -> double {return info.GetPT(); }}
+    };
+    return fields;
+
+  }  // end 'GetListOfCutFields()'
+
+
+
+  template <> const vector<Types::CutSet<Types::TrkInfo>::Field>& Types::CutSet<Types::TrkInfo>::GetListOfCutFields() {
+
+    static const vector<Field> fields = {
+      {"nMvtxLayer", [](const TrkInfo& info) -> double {return info.GetNMvtxLayer();}},
+      {"nInttLayer", [](const TrkInfo& info) -> double {return info.GetNInttLayer();}},
+      {"nTpcLayer",  [](const TrkInfo& info) -> double {return info.GetNTpcLayer(); }},
+      {"nMvtxClust", [](const TrkInfo& info) -> double {return info.GetNMvtxClust();}},
+      {"nInttClust", [](const TrkInfo& info) -> double {return info.GetNInttClust();}},
+      {"nTpcClust",  [](const TrkInfo& info) -> double {return info.GetNTpcClust(); }},
+      {"eta",        [](const TrkInfo& info) -> double {return info.GetEta();       }},
+      {"phi",        [](const TrkInfo& info) -> double {return info.GetPhi();       }},
+      {"px",         [](const TrkInfo& info) -> double {return info.GetPX();        }},
+      {"py",         [](const TrkInfo& info) -> double {return info.GetPY();        }},
+      {"pz",         [](const TrkInfo& info) -> double {return info.GetPZ();        }},
+      {"pt",         [](const TrkInfo& info) -> double {return info.GetPT();        }},
+      {"ene",        [](const TrkInfo& info) -> double {return info.GetEne();       }},
+      {"dcaXY",      [](const TrkInfo& info) -> double {return info.GetDcaXY();     }},
+      {"dcaZ",       [](const TrkInfo& info) -> double {return info.GetDcaZ();      }},
+      {"ptErr",      [](const TrkInfo& info) -> double {return info.GetPtErr();     }},
+      {"quality",    [](const TrkInfo& info) -> double {return info.GetQuality();   }},
+      {"vx",         [](const TrkInfo& info) -> double {return info.GetVX();        }},
+      {"vy",         [](const TrkInfo& info) -> double {return info.GetVY();        }},
+      {"vz",         [](const TrkInfo& info) -> double {return info.GetVZ();        }}
+    };
+    return fields;
+
+  }  // end 'GetListOfCutFields()'
+
+
+
+  // public methods -----------------------------------------------------------
+
+  template <class TInfo> void Types::CutSet<TInfo>::Reset() {
+
+    cuts.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  template <class TInfo> void Types::CutSet<TInfo>::Compile(const TInfo& minimum, const TInfo& maximum) {
+
+    // open limits are whatever Minimize() and Maximize() set
+    const TInfo lowest(Const::Init::Minimize);
+    const TInfo highest(Const::Init::Maximize);
+
+    // keep only fields where at least one limit is finite
+    cuts.clear();
+    for (const Field& field : GetListOfCutFields()) {
+      const double min       = field.get(minimum);
+      const double max       = field.get(maximum);
+      const bool   isBounded = ((min != field.get(lowest)) || (max != field.get(highest)));
+      if (isBounded) {
+        cuts.push_back({field.name, field.get, min, max});
+      }
+    }
+    return;
+
+  }  // end 'Compile(TInfo&, TInfo&)'
+
+
+
+  template <class TInfo> void Types::CutSet<TInfo>::Compile(const pair<TInfo, TInfo>& range) {
+
+    Compile(range.first, range.second);
+    return;
+
+  }  // end 'Compile(pair<TInfo, TInfo>&)'
+
+
+
+  template <class TInfo> bool Types::CutSet<TInfo>::Apply(const TInfo& info) const {
+
+    for (const Cut& cut : cuts) {
+      const double value = cut.get(info);
+      if ((value < cut.min) || (value > cut.max)) {
+        return false;
+      }
+    }
+    return true;
+
+  }  // end 'Apply(TInfo&)'
+
+
+
+  template <class TInfo> void Types::CutSet<TInfo>::Apply(const vector<TInfo>& infos, vector<uint8_t>& mask) const {
+
+    // loop over cuts first so each pass only touches one field
+    mask.assign(infos.size(), 1);
+    for (const Cut& cut : cuts) {
+      for (size_t iInfo = 0; iInfo < infos.size(); ++iInfo) {
+        const double value = cut.get(infos[iInfo]);
+        mask[iInfo] &= (uint8_t) ((value >= cut.min) && (value <= cut.max));
+      }
+    }
+    return;
+
+  }  // end 'Apply(vector<TInfo>&, vector<uint8_t>&)'
+
+
+
+  // ctor/dtor ----------------------------------------------------------------
+
+  template <class TInfo> Types::CutSet<TInfo>::CutSet() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  template <class TInfo> Types::CutSet<TInfo>::~CutSet() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  template <class TInfo> Types::CutSet<TInfo>::CutSet(const TInfo& minimum, const TInfo& maximum) {
+
+    Compile(minimum, maximum);
+
+  }  // end ctor(TInfo&, TInfo&)
+
+
+
+  template <class TInfo> Types::CutSet<TInfo>::CutSet(const pair<TInfo, TInfo>& range) {
+
+    Compile(range);
+
+  }  // end ctor(pair<TInfo, TInfo>&)
+
+
+
+  // explicit instantiations --------------------------------------------------
+
+  template class Types::CutSet<Types::ClustInfo>;
+  template class Types::CutSet<Types::CstInfo>;
+  template class Types::CutSet<Types::FlowInfo>;
+  template class Types::CutSet<Types::JetInfo>;
+  template class Types::CutSet<Types::ParInfo>;
+  template class Types::CutSet<Types::TrkInfo>;
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// 'CutSet.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Utility class to compile a (minimum, maximum) pair of
+// info objects down to the list of fields which are
+// actually bounded.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_CUTSET_H
+#define SCORRELATORUTILITIES_CUTSET_H
+
+// c++ utilities
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+// analysis utilities
+#include "ClustInfo.h"
+#include "CstInfo.h"
+#include "FlowInfo.h"
+#include "JetInfo.h"
+#include "ParInfo.h"
+#include "TrkInfo.h"
+#include "Constants.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // CutSet definition ------------------------------------------------------
+
+    template <class TInfo> class CutSet {
+
+      public:
+
+        // accessor for a single field
+        typedef double (*Getter)(const TInfo& info);
+
+        // a field that can be cut on
+        struct Field {
+          string name;
+          Getter get;
+        };
+
+        // a field with finite limits
+        struct Cut {
+          string name;
+          Getter get;
+          double min;
+          double max;
+        };
+
+      private:
+
+        // data members
+        vector<Cut> cuts;
+
+      public:
+
+        // getters
+        size_t             GetNumCuts() const {return cuts.size();}
+        const vector<Cut>& GetCuts()    const {return cuts;}
+
+        // public methods
+        void Reset();
+        void Compile(const TInfo& minimum, const TInfo& maximum);
+        void Compile(const pair<TInfo, TInfo>& range);
+        bool Apply(const TInfo& info) const;
+        void Apply(const vector<TInfo>& infos, vector<uint8_t>& mask) const;
+
+        // static methods
+        static const vector<Field>& GetListOfCutFields();
+
+        // default ctor/dtor
+        CutSet();
+        ~CutSet();
+
+        // ctors accepting arguments
+        CutSet(const TInfo& minimum, const TInfo& maximum);
+        CutSet(const pair<TInfo, TInfo>& range);
+
+    };  // end CutSet definition
+
+
+
+    // field lists ------------------------------------------------------------
+
+    template <> const vector<CutSet<ClustInfo>::Field>& CutSet<ClustInfo>::GetListOfCutFields();
+    template <> const vector<CutSet<CstInfo>::Field>&   CutSet<CstInfo>::GetListOfCutFields();
+    template <> const vector<CutSet<FlowInfo>::Field>&  CutSet<FlowInfo>::GetListOfCutFields();
+    template <> const vector<CutSet<JetInfo>::Field>&   CutSet<JetInfo>::GetListOfCutFields();
+    template <> const vector<CutSet<ParInfo>::Field>&   CutSet<ParInfo>::GetListOfCutFields();
+    template <> const vector<CutSet<TrkInfo>::Field>&   CutSet<TrkInfo>::GetListOfCutFields();
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
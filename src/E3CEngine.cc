@@ -0,0 +1,374 @@
+// ----------------------------------------------------------------------------
+// 'E3CEngine.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Engine to compute the full-shape three-point energy
+// correlator in (RL, xi, phi) over jet constituents.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_E3CENGINE_CC
+
+// class definition
+#include "E3CEngine.h"
+
+// c++ utilities
+#include <random>
+#include <algorithm>
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // internal methods ---------------------------------------------------------
+
+  void Tools::E3CEngine::WorkerLoop(const size_t iThread) {
+
+    uint64_t seen = 0;
+    while (true) {
+
+      // wait for a new batch of work
+      {
+        unique_lock<mutex> lock(poolMutex);
+        workReady.wait(lock, [&]() {return stop || (generation != seen);});
+        if (stop) return;
+        seen = generation;
+      }
+
+      // pull items until the batch is exhausted
+      for (size_t item = nextItem++; item < nItems; item = nextItem++) {
+        job(item, iThread);
+      }
+
+      // signal that this worker is done
+      {
+        lock_guard<mutex> lock(poolMutex);
+        if (--nBusy == 0) workDone.notify_one();
+      }
+    }  // end worker loop
+    return;
+
+  }  // end 'WorkerLoop(size_t)'
+
+
+
+  void Tools::E3CEngine::RunParallel(const size_t nWork, function<void(size_t, size_t)> work) {
+
+    // no pool: run everything on the calling thread
+    if (workers.empty()) {
+      for (size_t item = 0; item < nWork; ++item) {
+        work(item, 0);
+      }
+      return;
+    }
+
+    // publish batch
+    {
+      lock_guard<mutex> lock(poolMutex);
+      job      = move(work);
+      nItems   = nWork;
+      nextItem = 0;
+      nBusy    = workers.size();
+      ++generation;
+    }
+    workReady.notify_all();
+
+    // calling thread works as thread 0
+    for (size_t item = nextItem++; item < nItems; item = nextItem++) {
+      job(item, 0);
+    }
+
+    // wait for workers to finish
+    unique_lock<mutex> lock(poolMutex);
+    workDone.wait(lock, [&]() {return nBusy == 0;});
+    return;
+
+  }  // end 'RunParallel(size_t, function<void(size_t, size_t)>)'
+
+
+
+  void Tools::E3CEngine::BuildDistances() {
+
+    dr.resize(nCsts * nCsts);
+
+    // full symmetric matrix, one simd row per constituent
+    const Const::Simd level = ResolveSimdLevel(config.simd);
+    for (size_t iCst = 0; iCst < nCsts; ++iCst) {
+      double* row = dr.data() + (iCst * nCsts);
+      FillDeltaR2(etaCst[iCst], phiCst[iCst], etaCst.data(), phiCst.data(), nCsts, row, level);
+      for (size_t jCst = 0; jCst < nCsts; ++jCst) {
+        row[jCst] = sqrt(row[jCst]);
+      }
+    }
+    return;
+
+  }  // end 'BuildDistances()'
+
+
+
+  void Tools::E3CEngine::ProcessTiles() {
+
+    // enumerate tile triplets (I <= J <= K)
+    const size_t tile  = max(config.tileSize, (size_t) 1);
+    const size_t nTile = (nCsts + tile - 1) / tile;
+
+    tiles.clear();
+    for (size_t iTile = 0; iTile < nTile; ++iTile) {
+      for (size_t jTile = iTile; jTile < nTile; ++jTile) {
+        for (size_t kTile = jTile; kTile < nTile; ++kTile) {
+          tiles.push_back({(uint32_t) iTile, (uint32_t) jTile, (uint32_t) kTile});
+        }
+      }
+    }
+
+    // loop over the unique triplets (i < j < k) inside each tile triplet
+    RunParallel(
+      tiles.size(),
+      [&](const size_t item, const size_t iThread) {
+
+        const size_t iBegin = tiles[item][0] * tile;
+        const size_t jBegin = tiles[item][1] * tile;
+        const size_t kBegin = tiles[item][2] * tile;
+        const size_t iEnd   = min(iBegin + tile, nCsts);
+        const size_t jEnd   = min(jBegin + tile, nCsts);
+        const size_t kEnd   = min(kBegin + tile, nCsts);
+
+        Types::CorrHist3D& shard = shards[iThread];
+        for (size_t iCst = iBegin; iCst < iEnd; ++iCst) {
+          for (size_t jCst = max(jBegin, iCst + 1); jCst < jEnd; ++jCst) {
+            const double zIJ = z[iCst] * z[jCst];
+            for (size_t kCst = max(kBegin, jCst + 1); kCst < kEnd; ++kCst) {
+              FillTriplet(
+                shard,
+                dr[(iCst * nCsts) + jCst],
+                dr[(iCst * nCsts) + kCst],
+                dr[(jCst * nCsts) + kCst],
+                zIJ * z[kCst]
+              );
+            }
+          }
+        }
+      }
+    );
+    return;
+
+  }  // end 'ProcessTiles()'
+
+
+
+  void Tools::E3CEngine::ProcessSampled() {
+
+    // exact reweighting: C(n, 3) triplets represented by nSamples draws
+    const double nTriplets = ((double) nCsts * (double) (nCsts - 1) * (double) (nCsts - 2)) / 6.;
+    const double scale     = nTriplets / (double) config.nSamples;
+
+    // split draws into a few chunks per thread for balance
+    const size_t nChunks = 4 * max(config.nThreads, (size_t) 1);
+    RunParallel(
+      nChunks,
+      [&](const size_t chunk, const size_t iThread) {
+
+        // deterministic stream per (jet, chunk)
+        mt19937_64 rng(config.seed + (nJets * 0x9E3779B97F4A7C15ULL) + chunk);
+
+        const uint64_t nDraw = (config.nSamples / nChunks) + ((chunk < (config.nSamples % nChunks)) ? 1 : 0);
+        uniform_int_distribution<size_t> pickA(0, nCsts - 1);
+        uniform_int_distribution<size_t> pickB(0, nCsts - 2);
+        uniform_int_distribution<size_t> pickC(0, nCsts - 3);
+
+        Types::CorrHist3D& shard = shards[iThread];
+        for (uint64_t iDraw = 0; iDraw < nDraw; ++iDraw) {
+
+          // draw 3 distinct indices uniformly
+          size_t iCst = pickA(rng);
+          size_t jCst = pickB(rng);
+          size_t kCst = pickC(rng);
+          if (jCst >= iCst) ++jCst;
+
+          const size_t lo = min(iCst, jCst);
+          const size_t hi = max(iCst, jCst);
+          if (kCst >= lo) ++kCst;
+          if (kCst >= hi) ++kCst;
+
+          // n.b. no distance matrix here: it would cost O(n^2) memory
+          // and setup for the jets sampling is meant to handle
+          FillTriplet(
+            shard,
+            GetDeltaR(iCst, jCst),
+            GetDeltaR(iCst, kCst),
+            GetDeltaR(jCst, kCst),
+            z[iCst] * z[jCst] * z[kCst] * scale
+          );
+        }
+      }
+    );
+    return;
+
+  }  // end 'ProcessSampled()'
+
+
+
+  double Tools::E3CEngine::GetDeltaR(const size_t iCstA, const size_t iCstB) const {
+
+    // n.b. same wrapping as FillDeltaR2
+    const double dEta    = etaCst[iCstB] - etaCst[iCstA];
+    const double dPhiAbs = fabs(phiCst[iCstB] - phiCst[iCstA]);
+    const double dPhi    = min(dPhiAbs, (2. * M_PI) - dPhiAbs);
+    return sqrt((dEta * dEta) + (dPhi * dPhi));
+
+  }  // end 'GetDeltaR(size_t, size_t)'
+
+
+
+  void Tools::E3CEngine::FillTriplet(
+    Types::CorrHist3D& shard,
+    const double rAB,
+    const double rAC,
+    const double rBC,
+    const double weight
+  ) const {
+
+    // sort sides so that rL >= rM >= rS
+    double rL = rAB;
+    double rM = rAC;
+    double rS = rBC;
+    if (rM > rL) swap(rM, rL);
+    if (rS > rM) swap(rS, rM);
+    if (rM > rL) swap(rM, rL);
+
+    // shape coordinates
+    const double xi  = (rM > 0.) ? (rS / rM) : 0.;
+    const double arg = (rS > 0.) ? (1. - (((rL - rM) * (rL - rM)) / (rS * rS))) : 0.;
+    const double phi = asin(sqrt(max(arg, 0.)));
+
+    shard.Fill(rL, xi, phi, weight);
+    return;
+
+  }  // end 'FillTriplet(Types::CorrHist3D&, double, double, double, double)'
+
+
+
+  // public methods -----------------------------------------------------------
+
+  void Tools::E3CEngine::Reset() {
+
+    for (Types::CorrHist3D& shard : shards) {
+      shard.Reset();
+    }
+    nJets = 0;
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Tools::E3CEngine::Process(const double* arg_z, const double* eta, const double* phi, const size_t arg_nCsts) {
+
+    nCsts = arg_nCsts;
+    z.assign(arg_z, arg_z + nCsts);
+    etaCst.assign(eta, eta + nCsts);
+    phiCst.assign(phi, phi + nCsts);
+    if (nCsts >= 3) {
+      if ((nCsts > config.maxCsts) && (config.nSamples > 0)) {
+        ProcessSampled();
+      } else {
+        BuildDistances();
+        ProcessTiles();
+      }
+    }
+    ++nJets;
+    return;
+
+  }  // end 'Process(double*, double*, double*, size_t)'
+
+
+
+  void Tools::E3CEngine::Process(const Types::CstInfoSoA& csts, const Types::CstInfoSoA::JetRange& jet) {
+
+    Process(
+      csts.z.data() + jet.begin,
+      csts.eta.data() + jet.begin,
+      csts.phi.data() + jet.begin,
+      jet.Size()
+    );
+    return;
+
+  }  // end 'Process(Types::CstInfoSoA&, Types::CstInfoSoA::JetRange&)'
+
+
+
+  void Tools::E3CEngine::Process(const vector<Types::CstInfo>& csts) {
+
+    // gather hot columns into reusable scratch
+    thread_local Types::AlignedVector<double> zCst;
+    thread_local Types::AlignedVector<double> eta;
+    thread_local Types::AlignedVector<double> phi;
+
+    zCst.resize(csts.size());
+    eta.resize(csts.size());
+    phi.resize(csts.size());
+    for (size_t iCst = 0; iCst < csts.size(); ++iCst) {
+      zCst[iCst] = csts[iCst].GetZ();
+      eta[iCst]  = csts[iCst].GetEta();
+      phi[iCst]  = csts[iCst].GetPhi();
+    }
+
+    Process(zCst.data(), eta.data(), phi.data(), csts.size());
+    return;
+
+  }  // end 'Process(vector<Types::CstInfo>&)'
+
+
+
+  Types::CorrHist3D Tools::E3CEngine::GetHist() const {
+
+    Types::CorrHist3D sum = hist;
+    for (const Types::CorrHist3D& shard : shards) {
+      sum.Add(shard);
+    }
+    return sum;
+
+  }  // end 'GetHist()'
+
+
+
+  // ctor/dtor ----------------------------------------------------------------
+
+  Tools::E3CEngine::E3CEngine(
+    const E3CConfig& arg_config,
+    const Types::LogAxis& rlAxis,
+    const Types::LinAxis& xiAxis,
+    const Types::LinAxis& phiAxis
+  ) : config(arg_config), hist(rlAxis, xiAxis, phiAxis) {
+
+    config.nThreads = max(config.nThreads, (size_t) 1);
+    shards.assign(config.nThreads, hist);
+
+    // calling thread acts as thread 0
+    for (size_t iThread = 1; iThread < config.nThreads; ++iThread) {
+      workers.emplace_back(&E3CEngine::WorkerLoop, this, iThread);
+    }
+
+  }  // end ctor(E3CConfig&, Types::LogAxis&, Types::LinAxis&, Types::LinAxis&)
+
+
+
+  Tools::E3CEngine::~E3CEngine() {
+
+    {
+      lock_guard<mutex> lock(poolMutex);
+      stop = true;
+    }
+    workReady.notify_all();
+    for (thread& worker : workers) {
+      worker.join();
+    }
+
+  }  // end dtor()
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
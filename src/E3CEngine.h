@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// 'E3CEngine.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Engine to compute the full-shape three-point energy
+// correlator in (RL, xi, phi) over jet constituents.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_E3CENGINE_H
+#define SCORRELATORUTILITIES_E3CENGINE_H
+
+// c++ utilities
+#include <array>
+#include <cmath>
+#include <mutex>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <functional>
+#include <condition_variable>
+// analysis utilities
+#include "CstInfo.h"
+#include "CorrHist.h"
+#include "CorrTools.h"
+#include "Constants.h"
+#include "CstInfoSoA.h"
+#include "AlignedAllocator.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Tools {
+
+    // E3CConfig definition ---------------------------------------------------
+
+    struct E3CConfig {
+
+      // threading and tiling
+      size_t nThreads = 1;
+      size_t tileSize = 64;
+
+      // triplet budget: jets with more than maxCsts constituents are
+      // sampled with nSamples uniform triplets, reweighted by C(n, 3) / nSamples
+      size_t   maxCsts  = numeric_limits<size_t>::max();
+      uint64_t nSamples = 1000000;
+      uint64_t seed     = 12345;
+
+      // instruction set for pair distances
+      Const::Simd simd = Const::Simd::Auto;
+
+    };  // end E3CConfig definition
+
+
+
+    // E3CEngine definition ---------------------------------------------------
+
+    class E3CEngine {
+
+      private:
+
+        // configuration and output binning
+        E3CConfig         config;
+        Types::CorrHist3D hist;
+
+        // per-thread output shards
+        vector<Types::CorrHist3D> shards;
+
+        // per-jet constituents, pair-distance matrix, and tile list: n.b.
+        // the matrix is only built for jets processed exhaustively
+        size_t                       nCsts = 0;
+        uint64_t                     nJets = 0;
+        Types::AlignedVector<double> dr;
+        Types::AlignedVector<double> z;
+        Types::AlignedVector<double> etaCst;
+        Types::AlignedVector<double> phiCst;
+        vector<array<uint32_t, 3>>   tiles;
+
+        // thread pool
+        vector<thread>                 workers;
+        mutex                          poolMutex;
+        condition_variable             workReady;
+        condition_variable             workDone;
+        function<void(size_t, size_t)> job;
+        atomic<size_t>                 nextItem {0};
+        size_t                         nItems     = 0;
+        size_t                         nBusy      = 0;
+        uint64_t                       generation = 0;
+        bool                           stop       = false;
+
+        // internal methods
+        void WorkerLoop(const size_t iThread);
+        void RunParallel(const size_t nWork, function<void(size_t, size_t)> work);
+        void   BuildDistances();
+        void   ProcessTiles();
+        void   ProcessSampled();
+        double GetDeltaR(const size_t iCstA, const size_t iCstB) const;
+        void   FillTriplet(Types::CorrHist3D& shard, const double rAB, const double rAC, const double rBC, const double weight) const;
+
+      public:
+
+        // getters
+        const E3CConfig& GetConfig() const {return config;}
+
+        // public methods
+        void              Reset();
+        void              Process(const double* arg_z, const double* eta, const double* phi, const size_t arg_nCsts);
+        void              Process(const Types::CstInfoSoA& csts, const Types::CstInfoSoA::JetRange& jet);
+        void              Process(const vector<Types::CstInfo>& csts);
+        Types::CorrHist3D GetHist() const;
+
+        // ctor/dtor
+        E3CEngine(const E3CConfig& arg_config, const Types::LogAxis& rlAxis, const Types::LinAxis& xiAxis, const Types::LinAxis& phiAxis);
+        ~E3CEngine();
+
+        // not copyable: owns threads
+        E3CEngine(const E3CEngine&)            = delete;
+        E3CEngine& operator=(const E3CEngine&) = delete;
+
+    };  // end E3CEngine definition
+
+  }  // end Tools namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
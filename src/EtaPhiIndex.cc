@@ -0,0 +1,335 @@
+// ----------------------------------------------------------------------------
+// 'EtaPhiIndex.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Spatial index over (eta, phi) for delta-R neighbor
+// queries and matching between object collections.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_ETAPHIINDEX_CC
+
+// class definition
+#include "EtaPhiIndex.h"
+
+// c++ utilities
+#include <algorithm>
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // internal methods ---------------------------------------------------------
+
+  size_t Types::EtaPhiIndex::GetEtaCell(const double arg_eta) const {
+
+    // n.b. anything outside the indexed range is clamped to the edges
+    const double cell = floor((arg_eta - etaMin) / etaWidth);
+    if (!(cell > 0.))          return 0;
+    if (cell >= (double) nEta) return nEta - 1;
+    return (size_t) cell;
+
+  }  // end 'GetEtaCell(double)'
+
+
+
+  size_t Types::EtaPhiIndex::GetPhiCell(const double arg_phi) const {
+
+    // wrap phi into [0, 2pi)
+    double phiWrap = fmod(arg_phi, 2. * M_PI);
+    if (phiWrap < 0.) phiWrap += 2. * M_PI;
+
+    const size_t cell = (size_t) (phiWrap / phiWidth);
+    return min(cell, nPhi - 1);
+
+  }  // end 'GetPhiCell(double)'
+
+
+
+  double Types::EtaPhiIndex::GetDeltaR2(const double etaA, const double phiA, const size_t iPoint) const {
+
+    // n.b. phiA and stored phi are both in [0, 2pi)
+    const double dEta    = etaA - eta[iPoint];
+    const double dPhiAbs = fabs(phiA - phi[iPoint]);
+    const double dPhi    = min(dPhiAbs, (2. * M_PI) - dPhiAbs);
+    return (dEta * dEta) + (dPhi * dPhi);
+
+  }  // end 'GetDeltaR2(double, double, size_t)'
+
+
+
+  // builds -------------------------------------------------------------------
+
+  void Types::EtaPhiIndex::Build(const double* arg_eta, const double* arg_phi, const size_t nPoints) {
+
+    start.clear();
+    eta.clear();
+    phi.clear();
+    index.clear();
+    nEta = 0;
+    nPhi = 0;
+    if (nPoints == 0) return;
+
+    // size grid in eta to the points, capping the number of cells
+    // so a stray sentinel value can't blow up the grid
+    const size_t nEtaMax = 1024;
+    double       etaMax  = arg_eta[0];
+    etaMin = arg_eta[0];
+    for (size_t iPoint = 1; iPoint < nPoints; ++iPoint) {
+      etaMin = min(etaMin, arg_eta[iPoint]);
+      etaMax = max(etaMax, arg_eta[iPoint]);
+    }
+
+    const double range = etaMax - etaMin;
+    nEta     = clamp((size_t) ceil(range / cellSize), (size_t) 1, nEtaMax);
+    etaWidth = (range > 0.) ? (range / (double) nEta) : cellSize;
+
+    // phi cells are at least cellSize wide
+    nPhi     = max((size_t) floor((2. * M_PI) / cellSize), (size_t) 1);
+    phiWidth = (2. * M_PI) / (double) nPhi;
+
+    // counting sort of points into cells
+    vector<size_t> cells(nPoints);
+    start.assign((nEta * nPhi) + 1, 0);
+    for (size_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+      cells[iPoint] = (GetEtaCell(arg_eta[iPoint]) * nPhi) + GetPhiCell(arg_phi[iPoint]);
+      ++start[cells[iPoint] + 1];
+    }
+    for (size_t iCell = 0; iCell < (nEta * nPhi); ++iCell) {
+      start[iCell + 1] += start[iCell];
+    }
+
+    eta.resize(nPoints);
+    phi.resize(nPoints);
+    index.resize(nPoints);
+
+    vector<size_t> next(start.begin(), start.end() - 1);
+    for (size_t iPoint = 0; iPoint < nPoints; ++iPoint) {
+      const size_t slot = next[cells[iPoint]]++;
+
+      // store phi wrapped into [0, 2pi)
+      double phiWrap = fmod(arg_phi[iPoint], 2. * M_PI);
+      if (phiWrap < 0.) phiWrap += 2. * M_PI;
+
+      eta[slot]   = arg_eta[iPoint];
+      phi[slot]   = phiWrap;
+      index[slot] = iPoint;
+    }
+    return;
+
+  }  // end 'Build(double*, double*, size_t)'
+
+
+
+  template <typename T> void Types::EtaPhiIndex::Build(const vector<T>& objects) {
+
+    // gather coordinates, then build
+    vector<double> etas(objects.size());
+    vector<double> phis(objects.size());
+    for (size_t iObject = 0; iObject < objects.size(); ++iObject) {
+      etas[iObject] = objects[iObject].GetEta();
+      phis[iObject] = objects[iObject].GetPhi();
+    }
+    Build(etas.data(), phis.data(), objects.size());
+    return;
+
+  }  // end 'Build(vector<T>&)'
+
+
+
+  // queries ------------------------------------------------------------------
+
+  void Types::EtaPhiIndex::GetWithin(const double arg_eta, const double arg_phi, const double drMax, vector<size_t>& found) const {
+
+    found.clear();
+    if (index.empty()) return;
+
+    // wrap query phi into [0, 2pi)
+    double phiQuery = fmod(arg_phi, 2. * M_PI);
+    if (phiQuery < 0.) phiQuery += 2. * M_PI;
+
+    // window of cells which can contain points within drMax
+    const size_t etaLo   = GetEtaCell(arg_eta - drMax);
+    const size_t etaHi   = GetEtaCell(arg_eta + drMax);
+    const size_t phiCell = GetPhiCell(phiQuery);
+    const double phiSpan = ceil(drMax / phiWidth);
+    const bool   allPhi  = (((2. * phiSpan) + 1.) >= (double) nPhi);
+    const size_t nPhiWin = allPhi ? nPhi : ((2 * (size_t) phiSpan) + 1);
+    const size_t phiLo   = allPhi ? 0 : ((phiCell + nPhi - (size_t) phiSpan) % nPhi);
+    const double drMax2  = drMax * drMax;
+
+    for (size_t iEta = etaLo; iEta <= etaHi; ++iEta) {
+      for (size_t dPhi = 0; dPhi < nPhiWin; ++dPhi) {
+        const size_t cell = (iEta * nPhi) + ((phiLo + dPhi) % nPhi);
+        for (size_t iPoint = start[cell]; iPoint < start[cell + 1]; ++iPoint) {
+          if (GetDeltaR2(arg_eta, phiQuery, iPoint) <= drMax2) {
+            found.push_back(index[iPoint]);
+          }
+        }
+      }
+    }  // end eta cell loop
+    return;
+
+  }  // end 'GetWithin(double, double, double, vector<size_t>&)'
+
+
+
+  void Types::EtaPhiIndex::GetNearest(
+    const double arg_eta,
+    const double arg_phi,
+    const size_t k,
+    vector<pair<double, size_t>>& found,
+    const double drMax
+  ) const {
+
+    found.clear();
+    if (index.empty() || (k == 0)) return;
+
+    // wrap query phi into [0, 2pi)
+    double phiQuery = fmod(arg_phi, 2. * M_PI);
+    if (phiQuery < 0.) phiQuery += 2. * M_PI;
+
+    const size_t etaCell  = GetEtaCell(arg_eta);
+    const size_t phiCell  = GetPhiCell(phiQuery);
+    const double minWidth = min(etaWidth, phiWidth);
+    const double drMax2   = (drMax < sqrt(numeric_limits<double>::max())) ? (drMax * drMax) : numeric_limits<double>::max();
+
+    // keep the k best candidates in a max-heap on delta-R^2
+    auto visitCell = [&](const size_t iEta, const size_t iPhi) {
+      const size_t cell = (iEta * nPhi) + iPhi;
+      for (size_t iPoint = start[cell]; iPoint < start[cell + 1]; ++iPoint) {
+        const double dr2 = GetDeltaR2(arg_eta, phiQuery, iPoint);
+        if (dr2 > drMax2) continue;
+        if (found.size() < k) {
+          found.emplace_back(dr2, index[iPoint]);
+          push_heap(found.begin(), found.end());
+        } else if (dr2 < found.front().first) {
+          pop_heap(found.begin(), found.end());
+          found.back() = make_pair(dr2, index[iPoint]);
+          push_heap(found.begin(), found.end());
+        }
+      }
+    };
+
+    // expand rings of cells (chebyshev distance r, wrapping in phi) until
+    // nothing outside the rings can beat the current candidates
+    const size_t rMax = max(nEta - 1, nPhi / 2);
+    for (size_t ring = 0; ring <= rMax; ++ring) {
+
+      const size_t etaLo = (etaCell > ring) ? (etaCell - ring) : 0;
+      const size_t etaHi = min(etaCell + ring, nEta - 1);
+      for (size_t iEta = etaLo; iEta <= etaHi; ++iEta) {
+
+        // on the eta edges of the ring, take every phi cell within the ring
+        const size_t dEta = (iEta > etaCell) ? (iEta - etaCell) : (etaCell - iEta);
+        if (dEta == ring) {
+          if (((2 * ring) + 1) >= nPhi) {
+            for (size_t iPhi = 0; iPhi < nPhi; ++iPhi) {
+              visitCell(iEta, iPhi);
+            }
+          } else {
+            for (size_t dPhi = 0; dPhi < ((2 * ring) + 1); ++dPhi) {
+              visitCell(iEta, (phiCell + nPhi - ring + dPhi) % nPhi);
+            }
+          }
+          continue;
+        }
+
+        // otherwise only the phi cells exactly a ring away
+        if ((2 * ring) < nPhi) {
+          visitCell(iEta, (phiCell + nPhi - ring) % nPhi);
+          visitCell(iEta, (phiCell + ring) % nPhi);
+        } else if ((2 * ring) == nPhi) {
+          visitCell(iEta, (phiCell + ring) % nPhi);
+        }
+      }  // end eta cell loop
+
+      // anything beyond this ring is at least ring * minWidth away
+      const double bound = (double) ring * minWidth;
+      if (bound >= drMax) break;
+      if ((found.size() == k) && (found.front().first <= (bound * bound))) break;
+    }  // end ring loop
+
+    // sort by delta-R and convert from delta-R^2
+    sort_heap(found.begin(), found.end());
+    for (pair<double, size_t>& candidate : found) {
+      candidate.first = sqrt(candidate.first);
+    }
+    return;
+
+  }  // end 'GetNearest(double, double, size_t, vector<pair<double, size_t>>&, double)'
+
+
+
+  // matching -----------------------------------------------------------------
+
+  template <typename T> vector<int> Types::EtaPhiIndex::MatchNearest(const vector<T>& objects, const double drMax) const {
+
+    vector<int> matches(objects.size(), NoMatch);
+
+    vector<pair<double, size_t>> nearest;
+    for (size_t iObject = 0; iObject < objects.size(); ++iObject) {
+      GetNearest(objects[iObject].GetEta(), objects[iObject].GetPhi(), 1, nearest, drMax);
+      if (!nearest.empty()) {
+        matches[iObject] = (int) nearest.front().second;
+      }
+    }
+    return matches;
+
+  }  // end 'MatchNearest(vector<T>&, double)'
+
+
+
+  // ctor/dtor ----------------------------------------------------------------
+
+  Types::EtaPhiIndex::EtaPhiIndex() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::EtaPhiIndex::~EtaPhiIndex() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::EtaPhiIndex::EtaPhiIndex(const double arg_cellSize) {
+
+    // make sure cell size is sensible
+    if (!(arg_cellSize > 0.)) {
+      cerr << PHWHERE << "PANIC: trying to set eta-phi index with bad cell size! cellSize = " << arg_cellSize << endl;
+      assert(arg_cellSize > 0.);
+    }
+    cellSize = arg_cellSize;
+
+  }  // end ctor(double)
+
+
+
+  // explicit instantiations --------------------------------------------------
+
+  template void Types::EtaPhiIndex::Build(const vector<CstInfo>& objects);
+  template void Types::EtaPhiIndex::Build(const vector<JetInfo>& objects);
+  template void Types::EtaPhiIndex::Build(const vector<ParInfo>& objects);
+  template void Types::EtaPhiIndex::Build(const vector<TrkInfo>& objects);
+  template void Types::EtaPhiIndex::Build(const vector<FlowInfo>& objects);
+  template void Types::EtaPhiIndex::Build(const vector<ClustInfo>& objects);
+
+  template vector<int> Types::EtaPhiIndex::MatchNearest(const vector<CstInfo>& objects, const double drMax) const;
+  template vector<int> Types::EtaPhiIndex::MatchNearest(const vector<JetInfo>& objects, const double drMax) const;
+  template vector<int> Types::EtaPhiIndex::MatchNearest(const vector<ParInfo>& objects, const double drMax) const;
+  template vector<int> Types::EtaPhiIndex::MatchNearest(const vector<TrkInfo>& objects, const double drMax) const;
+  template vector<int> Types::EtaPhiIndex::MatchNearest(const vector<FlowInfo>& objects, const double drMax) const;
+  template vector<int> Types::EtaPhiIndex::MatchNearest(const vector<ClustInfo>& objects, const double drMax) const;
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
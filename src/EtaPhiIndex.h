@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// 'EtaPhiIndex.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Spatial index over (eta, phi) for delta-R neighbor
+// queries and matching between object collections.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_ETAPHIINDEX_H
+#define SCORRELATORUTILITIES_ETAPHIINDEX_H
+
+// c++ utilities
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <cassert>
+#include <iostream>
+// phool libraries
+#include <phool/phool.h>
+// analysis utilities
+#include "CstInfo.h"
+#include "JetInfo.h"
+#include "ParInfo.h"
+#include "TrkInfo.h"
+#include "FlowInfo.h"
+#include "ClustInfo.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // EtaPhiIndex definition -------------------------------------------------
+
+    class EtaPhiIndex {
+
+      private:
+
+        // grid: n.b. eta covers the range of the indexed points
+        // and phi covers [0, 2pi) with wrapping
+        double cellSize = 0.4;
+        double etaMin   = 0.;
+        double etaWidth = 0.;
+        double phiWidth = 0.;
+        size_t nEta     = 0;
+        size_t nPhi     = 0;
+
+        // points sorted by cell, with cell c spanning [start[c], start[c + 1])
+        vector<size_t> start;
+        vector<double> eta;
+        vector<double> phi;
+        vector<size_t> index;
+
+        // internal methods
+        size_t GetEtaCell(const double arg_eta) const;
+        size_t GetPhiCell(const double arg_phi) const;
+        double GetDeltaR2(const double etaA, const double phiA, const size_t iPoint) const;
+
+      public:
+
+        // n.b. returned by matching when nothing is within range
+        static constexpr int NoMatch = -1;
+
+        // getters
+        double GetCellSize() const {return cellSize;}
+        size_t GetNEta()     const {return nEta;}
+        size_t GetNPhi()     const {return nPhi;}
+        size_t Size()        const {return index.size();}
+
+        // builds: n.b. indices returned by queries refer to
+        // positions in the input arrays or vector
+        void Build(const double* arg_eta, const double* arg_phi, const size_t nPoints);
+        template <typename T> void Build(const vector<T>& objects);
+
+        // queries: both return original indices, and GetNearest returns
+        // up to k (delta-R, index) pairs within drMax sorted by delta-R
+        void GetWithin(const double arg_eta, const double arg_phi, const double drMax, vector<size_t>& found) const;
+        void GetNearest(
+          const double arg_eta,
+          const double arg_phi,
+          const size_t k,
+          vector<pair<double, size_t>>& found,
+          const double drMax = numeric_limits<double>::max()
+        ) const;
+
+        // matching: for each object, index of the nearest indexed
+        // point within drMax, or NoMatch
+        template <typename T> vector<int> MatchNearest(const vector<T>& objects, const double drMax) const;
+
+        // default ctor/dtor
+        EtaPhiIndex();
+        ~EtaPhiIndex();
+
+        // ctor accepting arguments
+        EtaPhiIndex(const double arg_cellSize);
+
+    };  // end EtaPhiIndex definition
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -124,6 +124,27 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  vector<Types::MemberLayout> Types::FlowInfo::GetMemberLayout() {
+
+    // n.b. same order and names as GetListOfMembers()
+    vector<MemberLayout> layout = {
+      {"id",   offsetof(FlowInfo, id),   Const::Leaf::Int},
+      {"type", offsetof(FlowInfo, type), Const::Leaf::Int},
+      {"mass", offsetof(FlowInfo, mass), Const::Leaf::Double},
+      {"eta",  offsetof(FlowInfo, eta),  Const::Leaf::Double},
+      {"phi",  offsetof(FlowInfo, phi),  Const::Leaf::Double},
+      {"ene",  offsetof(FlowInfo, ene),  Const::Leaf::Double},
+      {"px",   offsetof(FlowInfo, px),   Const::Leaf::Double},
+      {"py",   offsetof(FlowInfo, py),   Const::Leaf::Double},
+      {"pz",   offsetof(FlowInfo, pz),   Const::Leaf::Double},
+      {"pt",   offsetof(FlowInfo, pt),   Const::Leaf::Double}
+    };
+    return layout;
+
+  }  // end 'GetMemberLayout()'
+
+
+
   // overloaded operators -----------------------------------------------------
 
   bool Types::operator <(const FlowInfo& lhs, const FlowInfo& rhs) {
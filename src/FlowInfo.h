@@ -22,6 +22,7 @@
 #include <particleflowreco/ParticleFlowElementContainer.h>
 // analysis utilites
 #include "Constants.h"
+#include "MemberLayout.h"
 
 // make common namespaces implicit
 using namespace std;
@@ -86,7 +87,8 @@ namespace SColdQcdCorrelatorAnalysis {
         bool IsInAcceptance(const pair<FlowInfo, FlowInfo>& range) const;
 
         // static methods
-        static vector<string> GetListOfMembers();
+        static vector<string>       GetListOfMembers();
+        static vector<MemberLayout> GetMemberLayout();
 
         // overloaded operators
         friend bool operator <(const FlowInfo& lhs, const FlowInfo& rhs);
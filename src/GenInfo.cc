@@ -78,22 +78,16 @@ namespace SColdQcdCorrelatorAnalysis {
     // set embed flag
     isEmbed = embed;
 
-    // set parton info
-    isEmbed  = embed;
-    if (isEmbed) {
-      partons.first  = Tools::GetPartonInfo(topNode, Const::SubEvt::EmbedSignal, Const::HardScatterStatus::First);
-      partons.second = Tools::GetPartonInfo(topNode, Const::SubEvt::EmbedSignal, Const::HardScatterStatus::Second);
-
-    } else {
-      partons.first  = Tools::GetPartonInfo(topNode, Const::SubEvt::NotEmbedSignal, Const::HardScatterStatus::First);
-      partons.second = Tools::GetPartonInfo(topNode, Const::SubEvt::NotEmbedSignal, Const::HardScatterStatus::Second);
-    }
-
-    // get sums
-    nChrgPar = Tools::GetNumFinalStatePars(topNode, evtsToGrab, Const::Subset::Charged);
-    nNeuPar  = Tools::GetNumFinalStatePars(topNode, evtsToGrab, Const::Subset::Neutral);
-    eSumChrg = Tools::GetSumFinalStateParEne(topNode, evtsToGrab, Const::Subset::Charged);
-    eSumNeu  = Tools::GetSumFinalStateParEne(topNode, evtsToGrab, Const::Subset::Neutral);
+    // pick out signal subevent
+    const int signal = isEmbed ? Const::SubEvt::EmbedSignal : Const::SubEvt::NotEmbedSignal;
+
+    // walk each subevent once for sums and partons
+    const Tools::GenEventSummary summary = Tools::GetGenEventSummary(topNode, evtsToGrab, signal);
+    partons  = summary.partons;
+    nChrgPar = summary.GetNumPar(Const::Subset::Charged);
+    nNeuPar  = summary.GetNumPar(Const::Subset::Neutral);
+    eSumChrg = summary.GetSumEne(Const::Subset::Charged);
+    eSumNeu  = summary.GetSumEne(Const::Subset::Neutral);
     return;
 
   }  // end 'SetInfo(PHCompositeNode*, vector<int>)'
@@ -128,6 +122,37 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  vector<Types::MemberLayout> Types::GenInfo::GetMemberLayout() {
+
+    // n.b. same order and names as GetListOfMembers()
+    vector<MemberLayout> layout = {
+      {"nChrgPar", offsetof(GenInfo, nChrgPar), Const::Leaf::Int},
+      {"nNeuPar",  offsetof(GenInfo, nNeuPar),  Const::Leaf::Int},
+      {"isEmbed",  offsetof(GenInfo, isEmbed),  Const::Leaf::Bool},
+      {"eSumChrg", offsetof(GenInfo, eSumChrg), Const::Leaf::Double},
+      {"eSumNeu",  offsetof(GenInfo, eSumNeu),  Const::Leaf::Double}
+    };
+
+    // add parton members, shifted to where each parton sits
+    const GenInfo probe;
+    const size_t  offsetParA = reinterpret_cast<const char*>(&probe.partons.first) - reinterpret_cast<const char*>(&probe);
+    const size_t  offsetParB = reinterpret_cast<const char*>(&probe.partons.second) - reinterpret_cast<const char*>(&probe);
+    for (MemberLayout member : ParInfo::GetMemberLayout()) {
+      member.name.append("PartonA");
+      member.offset += offsetParA;
+      layout.push_back(member);
+    }
+    for (MemberLayout member : ParInfo::GetMemberLayout()) {
+      member.name.append("PartonB");
+      member.offset += offsetParB;
+      layout.push_back(member);
+    }
+    return layout;
+
+  }  // end 'GetMemberLayout()'
+
+
+
   // ctor/dtor ----------------------------------------------------------------
 
   Types::GenInfo::GenInfo() {
@@ -23,6 +23,7 @@
 #include "Tools.h"
 #include "ParInfo.h"
 #include "Constants.h"
+#include "MemberLayout.h"
 #include "Interfaces.h"
 
 // make common namespaces implicit
@@ -78,7 +79,8 @@ namespace SColdQcdCorrelatorAnalysis {
         void SetInfo(PHCompositeNode* topNode, const bool embed, const vector<int> evtsToGrab);
 
         // static methods
-        static vector<string> GetListOfMembers();
+        static vector<string>       GetListOfMembers();
+        static vector<MemberLayout> GetMemberLayout();
 
         // default ctor/dtor
         GenInfo();
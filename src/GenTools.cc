@@ -19,160 +19,217 @@ using namespace std;
 
 namespace SColdQcdCorrelatorAnalysis {
 
-  int64_t Tools::GetNumFinalStatePars(
+  // generator event summary --------------------------------------------------
+
+  void Tools::GenEventSummary::Reset() {
+
+    nChrgPar = 0;
+    nNeuPar  = 0;
+    eSumChrg = 0.;
+    eSumNeu  = 0.;
+    nPartons = 0;
+    nParByCharge.fill(0);
+    eSumByCharge.fill(0.);
+    partons.first.Reset();
+    partons.second.Reset();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Tools::GenEventSummary::AddEvent(
+    HepMC::GenEvent* genEvt,
+    const int event,
+    const bool countPars,
+    const bool findPartons
+  ) {
+
+    // loop over particles once
+    for (
+      HepMC::GenEvent::particle_const_iterator particle = genEvt -> particles_begin();
+      particle != genEvt -> particles_end();
+      ++particle
+    ) {
+
+      const int status = (*particle) -> status();
+
+      // grab first two outgoing partons
+      const bool isHardScatter = (
+        (status == Const::HardScatterStatus::First) ||
+        (status == Const::HardScatterStatus::Second)
+      );
+      if (findPartons && isHardScatter && (nPartons < 2)) {
+        Types::ParInfo parton(*particle, event);
+        if (parton.IsParton()) {
+          if (nPartons == 0) {
+            partons.first = parton;
+          } else {
+            partons.second = parton;
+          }
+          ++nPartons;
+        }
+      }
+
+      // stop early if only partons are needed
+      if (!countPars) {
+        if (nPartons >= 2) break;
+        continue;
+      }
+
+      // check if particle is final state
+      if (!Tools::IsFinalState(status)) continue;
+
+      const float  charge = Tools::GetParticleCharge((*particle) -> pdg_id());
+      const double energy = (*particle) -> momentum().e();
+      if (charge != 0.) {
+        ++nChrgPar;
+        eSumChrg += energy;
+      } else {
+        ++nNeuPar;
+        eSumNeu += energy;
+      }
+
+      // tally by charge
+      const long thirds = lround(3. * charge);
+      if (abs(thirds) <= MaxThirds) {
+        ++nParByCharge[thirds + MaxThirds];
+        eSumByCharge[thirds + MaxThirds] += energy;
+      }
+    }  // end particle loop
+    return;
+
+  }  // end 'AddEvent(HepMC::GenEvent*, int, bool, bool)'
+
+
+
+  int64_t Tools::GenEventSummary::GetNumPar(const Const::Subset subset) const {
+
+    int64_t nPar = 0;
+    switch (subset) {
+      case Const::Subset::Charged:
+        nPar = nChrgPar;
+        break;
+      case Const::Subset::Neutral:
+        nPar = nNeuPar;
+        break;
+      default:
+        nPar = nChrgPar + nNeuPar;
+        break;
+    }
+    return nPar;
+
+  }  // end 'GetNumPar(Const::Subset)'
+
+
+
+  int64_t Tools::GenEventSummary::GetNumPar(const float charge) const {
+
+    const long thirds = lround(3. * charge);
+    return (abs(thirds) <= MaxThirds) ? nParByCharge[thirds + MaxThirds] : 0;
+
+  }  // end 'GetNumPar(float)'
+
+
+
+  double Tools::GenEventSummary::GetSumEne(const Const::Subset subset) const {
+
+    double eSum = 0.;
+    switch (subset) {
+      case Const::Subset::Charged:
+        eSum = eSumChrg;
+        break;
+      case Const::Subset::Neutral:
+        eSum = eSumNeu;
+        break;
+      default:
+        eSum = eSumChrg + eSumNeu;
+        break;
+    }
+    return eSum;
+
+  }  // end 'GetSumEne(Const::Subset)'
+
+
+
+  double Tools::GenEventSummary::GetSumEne(const float charge) const {
+
+    const long thirds = lround(3. * charge);
+    return (abs(thirds) <= MaxThirds) ? eSumByCharge[thirds + MaxThirds] : 0.;
+
+  }  // end 'GetSumEne(float)'
+
+
+
+  // gen tools ----------------------------------------------------------------
+
+  Tools::GenEventSummary Tools::GetGenEventSummary(
     PHCompositeNode* topNode,
     const vector<int> evtsToGrab,
-    const Const::Subset subset,
-    optional<float> chargeToGrab
+    optional<int> signalEvt
   ) {
 
-    // loop over subevents
-    int64_t nPar = 0;
+    // walk each subevent once
+    GenEventSummary summary;
+    bool            foundSignal = false;
     for (const int evtToGrab : evtsToGrab) {
+      const bool isSignal = (signalEvt.has_value() && (evtToGrab == signalEvt.value()));
+      summary.AddEvent(Interfaces::GetGenEvent(topNode, evtToGrab), evtToGrab, true, isSignal);
+      foundSignal |= isSignal;
+    }
 
-      // loop over particles
-      HepMC::GenEvent* genEvt = Interfaces::GetGenEvent(topNode, evtToGrab);
-      for (
-        HepMC::GenEvent::particle_const_iterator particle = genEvt -> particles_begin();
-        particle != genEvt -> particles_end();
-        ++particle
-      ) {
-
-        // check if particle is final state
-        const bool isFinalState = Tools::IsFinalState((*particle) -> status());
-        if (!isFinalState) continue;
-
-        // if chargeToGrab is set, select only particle with charge
-        const float charge = Tools::GetParticleCharge((*particle) -> pdg_id());
-        if (chargeToGrab.has_value()) {
-          if (charge == chargeToGrab.value()) {
-            ++nPar;
-          }
-        } else {
-          switch (subset) {
-
-            // everything
-            case Const::Subset::All:
-              ++nPar;
-              break;
-
-            // all charged
-            case Const::Subset::Charged:
-              if (charge != 0.) {
-                ++nPar;
-              }
-              break;
-
-            // only neutral
-            case Const::Subset::Neutral:
-              if (charge == 0.) {
-                ++nPar;
-              }
-              break;
-
-            default:
-              ++nPar;
-              break;
-          }
-        }  // end if-else chargeToGrab.has_value()
-      }  // end particle loop
-    }  // end subevent loop
-    return nPar;
+    // if signal wasn't grabbed, still pick out its partons
+    if (signalEvt.has_value() && !foundSignal) {
+      summary.AddEvent(Interfaces::GetGenEvent(topNode, signalEvt.value()), signalEvt.value(), false, true);
+    }
+    return summary;
 
-  }  // end 'GetNumFinalStatePars(PHCompositeNode*, vector<int>, optional<float>, optional<float> bool)'
+  }  // end 'GetGenEventSummary(PHCompositeNode*, vector<int>, optional<int>)'
 
 
 
-  double Tools::GetSumFinalStateParEne(
+  int64_t Tools::GetNumFinalStatePars(
     PHCompositeNode* topNode,
     const vector<int> evtsToGrab,
     const Const::Subset subset,
     optional<float> chargeToGrab
   ) {
 
-    // loop over subevents
-    double eSum = 0.;
-    for (const int evtToGrab : evtsToGrab) {
+    const GenEventSummary summary = GetGenEventSummary(topNode, evtsToGrab);
+    if (chargeToGrab.has_value()) {
+      return summary.GetNumPar(chargeToGrab.value());
+    } else {
+      return summary.GetNumPar(subset);
+    }
 
-      HepMC::GenEvent* genEvt = Interfaces::GetGenEvent(topNode, evtToGrab);
-      for (
-        HepMC::GenEvent::particle_const_iterator particle = genEvt -> particles_begin();
-        particle != genEvt -> particles_end();
-        ++particle
-      ) {
-
-        // check if particle is final state
-        const bool isFinalState = Tools::IsFinalState((*particle) -> status());
-        if (!isFinalState) continue;
-
-        // if chargeToGrab is set, select only particle with charge
-        const float charge = Tools::GetParticleCharge((*particle) -> pdg_id());
-        const float energy = (*particle) -> momentum().e();
-        if (chargeToGrab.has_value()) {
-          if (charge == chargeToGrab.value()) {
-            eSum += energy;
-          }
-        } else {
-          switch (subset) {
-
-            // everything
-            case Const::Subset::All:
-              eSum += energy;
-              break;
-
-            // all charged
-            case Const::Subset::Charged:
-              if (charge != 0.) {
-                eSum += energy;
-              }
-              break;
-
-            // only neutral
-            case Const::Subset::Neutral:
-              if (charge == 0.) {
-                eSum += energy;
-              }
-              break;
-
-            default:
-              eSum += energy;
-              break;
-          }
-        }  // end if-else chargeToGrab.has_value()
-      }  // end particle loop
-    }  // end subevent loop
-    return eSum;
+  }  // end 'GetNumFinalStatePars(PHCompositeNode*, vector<int>, optional<float>, optional<float> bool)'
 
-  }  // end 'GetSumFinalStateParEne(PHCompositeNode*, vector<int>, int, optional<float>)'
 
 
+  double Tools::GetSumFinalStateParEne(
+    PHCompositeNode* topNode,
+    const vector<int> evtsToGrab,
+    const Const::Subset subset,
+    optional<float> chargeToGrab
+  ) {
 
-  Types::ParInfo Tools::GetPartonInfo(PHCompositeNode* topNode, const int event, const int status) {
+    const GenEventSummary summary = GetGenEventSummary(topNode, evtsToGrab);
+    if (chargeToGrab.has_value()) {
+      return summary.GetSumEne(chargeToGrab.value());
+    } else {
+      return summary.GetSumEne(subset);
+    }
 
-    // pick out relevant sub-sevent to grab
-    HepMC::GenEvent* genEvt = Interfaces::GetGenEvent(topNode, event);
+  }  // end 'GetSumFinalStateParEne(PHCompositeNode*, vector<int>, int, optional<float>)'
 
-    // loop over particles
-    Types::ParInfo parton;
-    for (
-      HepMC::GenEvent::particle_const_iterator particle = genEvt -> particles_begin();
-      particle != genEvt -> particles_end();
-      ++particle
-    ) {
 
-      // grab particle info
-      parton.Reset();
-      parton.SetInfo(*particle, event);
 
-      // ignore all non-partons
-      if (parton.IsParton()) continue;
+  Types::ParInfo Tools::GetPartonInfo(PHCompositeNode* topNode, const int event, const int status) {
 
-      // exit loop with info if parton is desired status
-      if (parton.IsHardScatterProduct()) {
-        break;
-      } 
-    }  // end particle loop
-    return parton;
+    // n.b. status selects the first (First) or second (Second) outgoing parton
+    GenEventSummary summary;
+    summary.AddEvent(Interfaces::GetGenEvent(topNode, event), event, false, true);
+    return (status == Const::HardScatterStatus::Second) ? summary.partons.second : summary.partons.first;
 
   }  // end 'GetPartonInfo(PHCompositeNode*, int, int)'
 
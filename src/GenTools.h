@@ -14,9 +14,12 @@
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 
 // c++ utilities
+#include <array>
+#include <cmath>
 #include <limits>
 #include <string>
 #include <vector>
+#include <utility>
 #include <optional>
 // root libraries
 #include <Math/Vector3D.h>
@@ -44,8 +47,43 @@ using namespace std;
 namespace SColdQcdCorrelatorAnalysis {
   namespace Tools {
 
+    // generator event summary ------------------------------------------------
+
+    struct GenEventSummary {
+
+      // per-charge tallies are indexed by 3q, for |q| <= 2
+      static constexpr int MaxThirds = 6;
+      static constexpr int NCharges  = (2 * MaxThirds) + 1;
+
+      // final state sums
+      int64_t nChrgPar = 0;
+      int64_t nNeuPar  = 0;
+      double  eSumChrg = 0.;
+      double  eSumNeu  = 0.;
+
+      // per-charge tallies
+      array<int64_t, NCharges> nParByCharge = {};
+      array<double, NCharges>  eSumByCharge = {};
+
+      // first two outgoing hard scatter partons
+      pair<Types::ParInfo, Types::ParInfo> partons;
+      size_t nPartons = 0;
+
+      // methods
+      void    Reset();
+      void    AddEvent(HepMC::GenEvent* genEvt, const int event, const bool countPars, const bool findPartons);
+      int64_t GetNumPar(const Const::Subset subset) const;
+      int64_t GetNumPar(const float charge) const;
+      double  GetSumEne(const Const::Subset subset) const;
+      double  GetSumEne(const float charge) const;
+
+    };  // end GenEventSummary definition
+
+
+
     // gen tools --------------------------------------------------------------
 
+    GenEventSummary GetGenEventSummary(PHCompositeNode* topNode, const vector<int> evtsToGrab, optional<int> signalEvt = nullopt);
     int64_t        GetNumFinalStatePars(PHCompositeNode* topNode, const vector<int> evtsToGrab, const Const::Subset subset, optional<float> chargeToGrab = nullopt);
     double         GetSumFinalStateParEne(PHCompositeNode* topNode, const vector<int> evtsToGrab, const Const::Subset subset, optional<float> chargeToGrab = nullopt);
     Types::ParInfo GetPartonInfo(PHCompositeNode* topNode, const int event, const int status);
@@ -11,7 +11,9 @@
 
 #include "ClustInterfaces.h"
 #include "FlowInterfaces.h"
+#include "NodeCache.h"
 #include "NodeInterfaces.h"
+#include "ParallelTreeProcessor.h"
 #include "ParInterfaces.h"
 #include "TreeInterfaces.h"
 #include "TrkInterfaces.h"
@@ -121,6 +121,27 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  vector<Types::MemberLayout> Types::JetInfo::GetMemberLayout() {
+
+    // n.b. same order and names as GetListOfMembers()
+    vector<MemberLayout> layout = {
+      {"jetID", offsetof(JetInfo, jetID), Const::Leaf::UInt32},
+      {"nCsts", offsetof(JetInfo, nCsts), Const::Leaf::UInt64},
+      {"ene",   offsetof(JetInfo, ene),   Const::Leaf::Double},
+      {"px",    offsetof(JetInfo, px),    Const::Leaf::Double},
+      {"py",    offsetof(JetInfo, py),    Const::Leaf::Double},
+      {"pz",    offsetof(JetInfo, pz),    Const::Leaf::Double},
+      {"pt",    offsetof(JetInfo, pt),    Const::Leaf::Double},
+      {"eta",   offsetof(JetInfo, eta),   Const::Leaf::Double},
+      {"phi",   offsetof(JetInfo, phi),   Const::Leaf::Double},
+      {"area",  offsetof(JetInfo, area),  Const::Leaf::Double}
+    };
+    return layout;
+
+  }  // end 'GetMemberLayout()'
+
+
+
   // overloaded operators -----------------------------------------------------
 
   bool Types::operator <(const JetInfo& lhs, const JetInfo& rhs) {
@@ -20,6 +20,7 @@
 #include <fastjet/PseudoJet.hh>
 // analysis utilities
 #include "Constants.h"
+#include "MemberLayout.h"
 
 // make common namespaces implicit
 using namespace std;
@@ -84,7 +85,8 @@ namespace SColdQcdCorrelatorAnalysis {
         bool IsInAcceptance(const pair<JetInfo, JetInfo>& range) const;
 
         // static methods
-        static vector<string> GetListOfMembers();
+        static vector<string>       GetListOfMembers();
+        static vector<MemberLayout> GetMemberLayout();
 
         // overloaded operators
         friend bool operator <(const JetInfo& lhs, const JetInfo& rhs);
@@ -0,0 +1,261 @@
+// ----------------------------------------------------------------------------
+// 'JetTools.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Collection of frequent jet-related methods utilized
+// in the sPHENIX Cold QCD Energy-Energy Correlator analysis.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_JETTOOLS_CC
+
+// namespace definition
+#include "JetTools.h"
+
+// c++ utilities
+#include <tuple>
+#include <algorithm>
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // jet matching -------------------------------------------------------------
+
+  Tools::JetMatches Tools::MatchJets(
+    const vector<Types::JetInfo>& truth,
+    const vector<Types::JetInfo>& reco,
+    const double drMax,
+    const Const::MatchAlgo algo,
+    const size_t nOptimalMax
+  ) {
+
+    const size_t nTruth = truth.size();
+    const size_t nReco  = reco.size();
+
+    JetMatches matches;
+    matches.truthToReco.assign(nTruth, -1);
+    matches.recoToTruth.assign(nReco, -1);
+
+    // collect candidate (delta-R, truth, reco) pairs: with cells of
+    // size drMax each query only touches the neighboring cells
+    vector<tuple<double, size_t, size_t>> candidates;
+    if ((drMax > 0.) && (nTruth > 0) && (nReco > 0)) {
+      Types::EtaPhiIndex index(drMax);
+      index.Build(reco);
+
+      vector<size_t> found;
+      for (size_t iTruth = 0; iTruth < nTruth; ++iTruth) {
+        index.GetWithin(truth[iTruth].GetEta(), truth[iTruth].GetPhi(), drMax, found);
+        for (const size_t iReco : found) {
+          const double dEta    = truth[iTruth].GetEta() - reco[iReco].GetEta();
+          const double dPhiAbs = fabs(remainder(truth[iTruth].GetPhi() - reco[iReco].GetPhi(), 2. * M_PI));
+          candidates.emplace_back(hypot(dEta, dPhiAbs), iTruth, iReco);
+        }
+      }
+    }
+
+    // split candidates into connected groups (truth nodes first, then
+    // reco nodes) so each group can be solved on its own
+    vector<size_t> parent(nTruth + nReco);
+    for (size_t iNode = 0; iNode < parent.size(); ++iNode) {
+      parent[iNode] = iNode;
+    }
+    auto findRoot = [&parent](size_t node) {
+      while (parent[node] != node) {
+        parent[node] = parent[parent[node]];
+        node         = parent[node];
+      }
+      return node;
+    };
+    for (const auto& [dr, iTruth, iReco] : candidates) {
+      parent[findRoot(iTruth)] = findRoot(nTruth + iReco);
+    }
+
+    // sort by group, then delta-R, so each group is a contiguous run
+    // already in greedy order
+    vector<pair<size_t, size_t>> order(candidates.size());
+    for (size_t iCand = 0; iCand < candidates.size(); ++iCand) {
+      order[iCand] = {findRoot(get<1>(candidates[iCand])), iCand};
+    }
+    sort(
+      order.begin(),
+      order.end(),
+      [&candidates](const pair<size_t, size_t>& lhs, const pair<size_t, size_t>& rhs) {
+        if (lhs.first != rhs.first) return lhs.first < rhs.first;
+        return candidates[lhs.second] < candidates[rhs.second];
+      }
+    );
+
+    // solve each group
+    vector<size_t> rows;
+    vector<size_t> cols;
+    vector<double> cost;
+    for (size_t begin = 0; begin < order.size();) {
+
+      size_t end = begin;
+      while ((end < order.size()) && (order[end].first == order[begin].first)) {
+        ++end;
+      }
+
+      // distinct truth (rows) and reco (cols) jets in group
+      rows.clear();
+      cols.clear();
+      for (size_t iOrder = begin; iOrder < end; ++iOrder) {
+        rows.push_back(get<1>(candidates[order[iOrder].second]));
+        cols.push_back(get<2>(candidates[order[iOrder].second]));
+      }
+      sort(rows.begin(), rows.end());
+      sort(cols.begin(), cols.end());
+      rows.erase(unique(rows.begin(), rows.end()), rows.end());
+      cols.erase(unique(cols.begin(), cols.end()), cols.end());
+
+      const bool useOptimal = (algo == Const::MatchAlgo::Hungarian) ||
+                              ((algo == Const::MatchAlgo::Auto) && (rows.size() <= nOptimalMax) && (cols.size() <= nOptimalMax));
+      if (useOptimal && (end - begin > 1)) {
+
+        // n.b. a non-candidate pair costs more than any set of candidate
+        // pairs, so the solver first maximizes the number of matches
+        const double forbidden = ((double) (min(rows.size(), cols.size()) + 1) * drMax) + 1.;
+        cost.assign(rows.size() * cols.size(), forbidden);
+        for (size_t iOrder = begin; iOrder < end; ++iOrder) {
+          const auto& [dr, iTruth, iReco] = candidates[order[iOrder].second];
+          const size_t iRow = lower_bound(rows.begin(), rows.end(), iTruth) - rows.begin();
+          const size_t iCol = lower_bound(cols.begin(), cols.end(), iReco) - cols.begin();
+          cost[(iRow * cols.size()) + iCol] = dr;
+        }
+
+        const vector<int> assignment = SolveAssignment(cost, rows.size(), cols.size());
+        for (size_t iRow = 0; iRow < rows.size(); ++iRow) {
+          if (assignment[iRow] < 0) continue;
+          if (cost[(iRow * cols.size()) + assignment[iRow]] >= forbidden) continue;
+          matches.truthToReco[rows[iRow]]             = (int) cols[assignment[iRow]];
+          matches.recoToTruth[cols[assignment[iRow]]] = (int) rows[iRow];
+        }
+      } else {
+
+        // greedy: closest free pair first
+        for (size_t iOrder = begin; iOrder < end; ++iOrder) {
+          const auto& [dr, iTruth, iReco] = candidates[order[iOrder].second];
+          if ((matches.truthToReco[iTruth] >= 0) || (matches.recoToTruth[iReco] >= 0)) continue;
+          matches.truthToReco[iTruth] = (int) iReco;
+          matches.recoToTruth[iReco]  = (int) iTruth;
+        }
+      }
+      begin = end;
+    }  // end group loop
+
+    // collect matched pairs, misses, and fakes
+    for (size_t iTruth = 0; iTruth < nTruth; ++iTruth) {
+      const int iReco = matches.truthToReco[iTruth];
+      if (iReco < 0) {
+        matches.misses.push_back(iTruth);
+        continue;
+      }
+      const double dEta    = truth[iTruth].GetEta() - reco[iReco].GetEta();
+      const double dPhiAbs = fabs(remainder(truth[iTruth].GetPhi() - reco[iReco].GetPhi(), 2. * M_PI));
+      matches.matched.emplace_back(iTruth, (size_t) iReco);
+      matches.drMatched.push_back(hypot(dEta, dPhiAbs));
+    }
+    for (size_t iReco = 0; iReco < nReco; ++iReco) {
+      if (matches.recoToTruth[iReco] < 0) {
+        matches.fakes.push_back(iReco);
+      }
+    }
+    return matches;
+
+  }  // end 'MatchJets(vector<Types::JetInfo>&, vector<Types::JetInfo>&, double, Const::MatchAlgo, size_t)'
+
+
+
+  vector<int> Tools::SolveAssignment(const vector<double>& cost, const size_t nRows, const size_t nCols) {
+
+    // solver below needs rows <= cols, so transpose if needed
+    if (nRows > nCols) {
+      vector<double> costT(nRows * nCols);
+      for (size_t iRow = 0; iRow < nRows; ++iRow) {
+        for (size_t iCol = 0; iCol < nCols; ++iCol) {
+          costT[(iCol * nRows) + iRow] = cost[(iRow * nCols) + iCol];
+        }
+      }
+      const vector<int> colToRow = SolveAssignment(costT, nCols, nRows);
+
+      vector<int> rowToCol(nRows, -1);
+      for (size_t iCol = 0; iCol < nCols; ++iCol) {
+        if (colToRow[iCol] >= 0) {
+          rowToCol[colToRow[iCol]] = (int) iCol;
+        }
+      }
+      return rowToCol;
+    }
+
+    // hungarian algorithm with row/column potentials: n.b. uses
+    // 1-indexed arrays, with column 0 as a sentinel
+    const double   inf = numeric_limits<double>::max();
+    vector<double> uRow(nRows + 1, 0.);
+    vector<double> vCol(nCols + 1, 0.);
+    vector<size_t> rowOfCol(nCols + 1, 0);
+    vector<size_t> way(nCols + 1, 0);
+    vector<double> minSlack(nCols + 1);
+    vector<bool>   used(nCols + 1);
+
+    for (size_t iRow = 1; iRow <= nRows; ++iRow) {
+
+      rowOfCol[0] = iRow;
+      size_t col0 = 0;
+      minSlack.assign(nCols + 1, inf);
+      used.assign(nCols + 1, false);
+
+      // grow alternating tree until a free column is reached
+      do {
+        used[col0] = true;
+        const size_t row0  = rowOfCol[col0];
+        double       delta = inf;
+        size_t       col1  = 0;
+        for (size_t iCol = 1; iCol <= nCols; ++iCol) {
+          if (used[iCol]) continue;
+          const double slack = cost[((row0 - 1) * nCols) + (iCol - 1)] - uRow[row0] - vCol[iCol];
+          if (slack < minSlack[iCol]) {
+            minSlack[iCol] = slack;
+            way[iCol]      = col0;
+          }
+          if (minSlack[iCol] < delta) {
+            delta = minSlack[iCol];
+            col1  = iCol;
+          }
+        }
+        for (size_t iCol = 0; iCol <= nCols; ++iCol) {
+          if (used[iCol]) {
+            uRow[rowOfCol[iCol]] += delta;
+            vCol[iCol]           -= delta;
+          } else {
+            minSlack[iCol] -= delta;
+          }
+        }
+        col0 = col1;
+      } while (rowOfCol[col0] != 0);
+
+      // flip the augmenting path
+      do {
+        const size_t col1 = way[col0];
+        rowOfCol[col0] = rowOfCol[col1];
+        col0           = col1;
+      } while (col0 != 0);
+    }  // end row loop
+
+    vector<int> rowToCol(nRows, -1);
+    for (size_t iCol = 1; iCol <= nCols; ++iCol) {
+      if (rowOfCol[iCol] != 0) {
+        rowToCol[rowOfCol[iCol] - 1] = (int) (iCol - 1);
+      }
+    }
+    return rowToCol;
+
+  }  // end 'SolveAssignment(vector<double>&, size_t, size_t)'
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
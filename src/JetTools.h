@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// 'JetTools.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Collection of frequent jet-related methods utilized
+// in the sPHENIX Cold QCD Energy-Energy Correlator analysis.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_JETTOOLS_H
+#define SCORRELATORUTILITIES_JETTOOLS_H
+
+// c++ utilities
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+// analysis utilities
+#include "JetInfo.h"
+#include "Constants.h"
+#include "EtaPhiIndex.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Tools {
+
+    // JetMatches definition --------------------------------------------------
+
+    struct JetMatches {
+
+      // matched (truth, reco) index pairs and their delta-R
+      vector<pair<size_t, size_t>> matched;
+      vector<double>               drMatched;
+
+      // truth jets without a reco partner, and vice versa
+      vector<size_t> misses;
+      vector<size_t> fakes;
+
+      // lookups from either side: n.b. -1 if unmatched
+      vector<int> truthToReco;
+      vector<int> recoToTruth;
+
+    };  // end JetMatches definition
+
+
+
+    // jet matching -----------------------------------------------------------
+
+    // n.b. candidate pairs within drMax are found with an EtaPhiIndex and
+    // split into connected groups. Greedy takes the closest free pair
+    // first; Hungarian maximizes the number of matches in each group and
+    // then minimizes the summed delta-R. Auto uses Hungarian for groups
+    // with at most nOptimalMax jets on either side and greedy otherwise
+    JetMatches MatchJets(
+      const vector<Types::JetInfo>& truth,
+      const vector<Types::JetInfo>& reco,
+      const double drMax,
+      const Const::MatchAlgo algo = Const::MatchAlgo::Auto,
+      const size_t nOptimalMax = 32
+    );
+
+    // optimal assignment on a dense rows x cols cost matrix (row-major),
+    // returning the column for each row (-1 if rows > cols and unassigned)
+    vector<int> SolveAssignment(const vector<double>& cost, const size_t nRows, const size_t nCols);
+
+  }  // end Tools namespace
+}  // end SColdQcdCorrealtorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,61 @@
+// ----------------------------------------------------------------------------
+// 'MemberLayout.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Name, offset, and leaf type of a single info member, used
+// to bind tree branches directly into info objects.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_MEMBERLAYOUT_H
+#define SCORRELATORUTILITIES_MEMBERLAYOUT_H
+
+// c++ utilities
+#include <string>
+#include <cstddef>
+#include <cstdint>
+// analysis utilities
+#include "Constants.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // MemberLayout definition ------------------------------------------------
+
+    // n.b. name matches the info's GetListOfMembers() entry, and
+    // offset is the byte offset of the member within the info
+    struct MemberLayout {
+      string      name;
+      size_t      offset;
+      Const::Leaf leaf;
+    };
+
+
+
+    // leaf dispatch ----------------------------------------------------------
+
+    // n.b. calls func with a null pointer of the leaf's c++ type, so
+    // that generic code can recover the type via decltype
+    template <typename TFunc> void VisitLeaf(const Const::Leaf leaf, TFunc func) {
+      switch (leaf) {
+        case Const::Leaf::Bool:   func(static_cast<bool*>(nullptr));     break;
+        case Const::Leaf::Int:    func(static_cast<int*>(nullptr));      break;
+        case Const::Leaf::Int64:  func(static_cast<int64_t*>(nullptr));  break;
+        case Const::Leaf::UInt32: func(static_cast<uint32_t*>(nullptr)); break;
+        case Const::Leaf::UInt64: func(static_cast<uint64_t*>(nullptr)); break;
+        case Const::Leaf::Float:  func(static_cast<float*>(nullptr));    break;
+        case Const::Leaf::Double: func(static_cast<double*>(nullptr));   break;
+      }
+    }
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// 'NodeCache.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Event-scoped cache of node handles so that repeated
+// Interfaces getters don't walk the node tree each call.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_NODECACHE_CC
+
+// class definition
+#include "NodeCache.h"
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // node cache public methods ------------------------------------------------
+
+  void Interfaces::NodeCache::Reset() {
+
+    mapTrks    = NULL;
+    mapVtxs    = NULL;
+    flowStore  = NULL;
+    truthStore = NULL;
+    mapMcEvts  = NULL;
+    clustStores.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Interfaces::NodeCache::SetTopNode(PHCompositeNode* arg_topNode) {
+
+    // n.b. handles are only valid for the event they were found in
+    Reset();
+    topNode = arg_topNode;
+    return;
+
+  }  // end 'SetTopNode(PHCompositeNode*)'
+
+
+
+  SvtxTrackMap* Interfaces::NodeCache::GetTrackMap() {
+
+    if (!mapTrks) {
+      mapTrks = Interfaces::GetTrackMap(topNode);
+    }
+    return mapTrks;
+
+  }  // end 'GetTrackMap()'
+
+
+
+  GlobalVertexMap* Interfaces::NodeCache::GetVertexMap() {
+
+    if (!mapVtxs) {
+      mapVtxs = Interfaces::GetVertexMap(topNode);
+    }
+    return mapVtxs;
+
+  }  // end 'GetVertexMap()'
+
+
+
+  ParticleFlowElementContainer* Interfaces::NodeCache::GetFlowStore() {
+
+    if (!flowStore) {
+      flowStore = Interfaces::GetFlowStore(topNode);
+    }
+    return flowStore;
+
+  }  // end 'GetFlowStore()'
+
+
+
+  PHG4TruthInfoContainer* Interfaces::NodeCache::GetTruthContainer() {
+
+    if (!truthStore) {
+      truthStore = Interfaces::GetTruthContainer(topNode);
+    }
+    return truthStore;
+
+  }  // end 'GetTruthContainer()'
+
+
+
+  PHHepMCGenEventMap* Interfaces::NodeCache::GetMcEventMap() {
+
+    if (!mapMcEvts) {
+      mapMcEvts = Interfaces::GetMcEventMap(topNode);
+    }
+    return mapMcEvts;
+
+  }  // end 'GetMcEventMap()'
+
+
+
+  RawClusterContainer* Interfaces::NodeCache::GetClusterStore(const string node) {
+
+    // cluster stores are keyed by node name
+    auto itStore = clustStores.find(node);
+    if (itStore == clustStores.end()) {
+      itStore = clustStores.emplace(node, Interfaces::GetClusterStore(topNode, node)).first;
+    }
+    return itStore -> second;
+
+  }  // end 'GetClusterStore(string)'
+
+
+
+  RawClusterContainer::ConstRange Interfaces::NodeCache::GetClusters(const string store) {
+
+    return GetClusterStore(store) -> getClusters();
+
+  }  // end 'GetClusters(string)'
+
+
+
+  ParticleFlowElementContainer::ConstRange Interfaces::NodeCache::GetParticleFlowObjects() {
+
+    return GetFlowStore() -> getParticleFlowElements();
+
+  }  // end 'GetParticleFlowObjects()'
+
+
+
+  PHHepMCGenEvent* Interfaces::NodeCache::GetMcEvent(const int iEvtToGrab) {
+
+    PHHepMCGenEvent* mcEvt = GetMcEventMap() -> get(iEvtToGrab);
+    if (!mcEvt) {
+      cerr << PHWHERE
+           << "PANIC: Couldn't grab mc event!"
+           << endl;
+      assert(mcEvt);
+    }
+    return mcEvt;
+
+  }  // end 'GetMcEvent(int)'
+
+
+
+  HepMC::GenEvent* Interfaces::NodeCache::GetGenEvent(const int iEvtToGrab) {
+
+    HepMC::GenEvent* genEvt = GetMcEvent(iEvtToGrab) -> getEvent();
+    if (!genEvt) {
+      cerr << PHWHERE
+           << "PANIC: Couldn't grab HepMC event!"
+           << endl;
+      assert(genEvt);
+    }
+    return genEvt;
+
+  }  // end 'GetGenEvent(int)'
+
+
+
+  // node cache ctor/dtor -----------------------------------------------------
+
+  Interfaces::NodeCache::NodeCache() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Interfaces::NodeCache::~NodeCache() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Interfaces::NodeCache::NodeCache(PHCompositeNode* arg_topNode) {
+
+    SetTopNode(arg_topNode);
+
+  }  // end ctor(PHCompositeNode*)
+
+}  // end SColdQcdCorrealtorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// 'NodeCache.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Event-scoped cache of node handles so that repeated
+// Interfaces getters don't walk the node tree each call.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_NODECACHE_H
+#define SCORRELATORUTILITIES_NODECACHE_H
+
+// c++ utilities
+#include <string>
+#include <unordered_map>
+// phool libraries
+#include <phool/phool.h>
+#include <phool/PHCompositeNode.h>
+// analysis utilities
+#include "ParInterfaces.h"
+#include "TrkInterfaces.h"
+#include "VtxInterfaces.h"
+#include "FlowInterfaces.h"
+#include "ClustInterfaces.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Interfaces {
+
+    // node cache definition --------------------------------------------------
+
+    class NodeCache {
+
+      private:
+
+        // bound node tree
+        PHCompositeNode* topNode = NULL;
+
+        // handles, resolved on first use
+        SvtxTrackMap*                               mapTrks    = NULL;
+        GlobalVertexMap*                            mapVtxs    = NULL;
+        ParticleFlowElementContainer*               flowStore  = NULL;
+        PHG4TruthInfoContainer*                     truthStore = NULL;
+        PHHepMCGenEventMap*                         mapMcEvts  = NULL;
+        unordered_map<string, RawClusterContainer*> clustStores;
+
+      public:
+
+        // getters
+        PHCompositeNode* GetTopNode() const {return topNode;}
+
+        // public methods
+        void Reset();
+        void SetTopNode(PHCompositeNode* arg_topNode);
+
+        // typed accessors: n.b. these look up the node on first
+        // use after a Reset() and return the cached handle after
+        SvtxTrackMap*                            GetTrackMap();
+        GlobalVertexMap*                         GetVertexMap();
+        ParticleFlowElementContainer*            GetFlowStore();
+        PHG4TruthInfoContainer*                  GetTruthContainer();
+        PHHepMCGenEventMap*                      GetMcEventMap();
+        RawClusterContainer*                     GetClusterStore(const string node);
+        RawClusterContainer::ConstRange          GetClusters(const string store);
+        ParticleFlowElementContainer::ConstRange GetParticleFlowObjects();
+        PHHepMCGenEvent*                         GetMcEvent(const int iEvtToGrab);
+        HepMC::GenEvent*                         GetGenEvent(const int iEvtToGrab);
+
+        // default ctor/dtor
+        NodeCache();
+        ~NodeCache();
+
+        // ctor accepting arguments
+        NodeCache(PHCompositeNode* arg_topNode);
+
+    };  // end NodeCache definition
+
+  }  // end Interfaces namespace
+}  // end SColdQcdCorrealtorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
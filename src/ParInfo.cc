@@ -88,7 +88,7 @@ namespace SColdQcdCorrelatorAnalysis {
     status  = particle -> status();
     barcode = particle -> barcode();
     embedID = event;
-    charge  = Const::MapPidOntoCharge()[pid];
+    charge  = Const::GetPdgCharge(pid);
     mass    = particle -> momentum().m();
     eta     = particle -> momentum().eta();
     phi     = particle -> momentum().phi();
@@ -110,8 +110,8 @@ namespace SColdQcdCorrelatorAnalysis {
     status  = numeric_limits<int>::max();  // FIXME there must be a way to get the status of these particles
     barcode = particle -> get_barcode();
     embedID = event;
-    charge  = Const::MapPidOntoCharge()[pid];
-    mass    = numeric_limits<double>::max();  // FIXME likewise for mass
+    charge  = Const::GetPdgCharge(pid);
+    mass    = Const::GetPdgMass(pid);
     ene     = particle -> get_e();
     px      = particle -> get_px();
     py      = particle -> get_py();
@@ -232,6 +232,34 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  vector<Types::MemberLayout> Types::ParInfo::GetMemberLayout() {
+
+    // n.b. same order and names as GetListOfMembers()
+    vector<MemberLayout> layout = {
+      {"pid",     offsetof(ParInfo, pid),     Const::Leaf::Int},
+      {"status",  offsetof(ParInfo, status),  Const::Leaf::Int},
+      {"barcode", offsetof(ParInfo, barcode), Const::Leaf::Int},
+      {"embedID", offsetof(ParInfo, embedID), Const::Leaf::Int},
+      {"charge",  offsetof(ParInfo, charge),  Const::Leaf::Float},
+      {"mass",    offsetof(ParInfo, mass),    Const::Leaf::Double},
+      {"eta",     offsetof(ParInfo, eta),     Const::Leaf::Double},
+      {"phi",     offsetof(ParInfo, phi),     Const::Leaf::Double},
+      {"ene",     offsetof(ParInfo, ene),     Const::Leaf::Double},
+      {"px",      offsetof(ParInfo, px),      Const::Leaf::Double},
+      {"py",      offsetof(ParInfo, py),      Const::Leaf::Double},
+      {"pz",      offsetof(ParInfo, pz),      Const::Leaf::Double},
+      {"pt",      offsetof(ParInfo, pt),      Const::Leaf::Double},
+      {"vx",      offsetof(ParInfo, vx),      Const::Leaf::Double},
+      {"vy",      offsetof(ParInfo, vy),      Const::Leaf::Double},
+      {"vz",      offsetof(ParInfo, vz),      Const::Leaf::Double},
+      {"vr",      offsetof(ParInfo, vr),      Const::Leaf::Double}
+    };
+    return layout;
+
+  }  // end 'GetMemberLayout()'
+
+
+
   bool Types::operator >(const ParInfo& lhs, const ParInfo& rhs) {
 
     // note that some quantities aren't relevant for this comparison
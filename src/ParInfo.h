@@ -27,6 +27,7 @@
 #include <HepMC/GenParticle.h>
 // analysis utilities
 #include "Constants.h"
+#include "MemberLayout.h"
 
 #pragma GCC diagnostic pop
 
@@ -119,7 +120,8 @@ namespace SColdQcdCorrelatorAnalysis {
         bool IsOutgoingParton() const;
 
         // static methods
-        static vector<string> GetListOfMembers();
+        static vector<string>       GetListOfMembers();
+        static vector<MemberLayout> GetMemberLayout();
 
         // overloaded operators
         friend bool operator <(const ParInfo& lhs, const ParInfo& rhs);
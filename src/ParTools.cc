@@ -101,14 +101,8 @@ namespace SColdQcdCorrelatorAnalysis {
 
   float Tools::GetParticleCharge(const int pid) {
 
-    // particle charge
-    float charge = Const::MapPidOntoCharge()[abs(pid)];
-
-    // if antiparticle, flip charge and return
-    if (pid < 0) {
-      charge *= -1.;
-    }
-    return charge;
+    // n.b. table lookup is read-only and flips charge for antiparticles
+    return Const::GetPdgCharge(pid);
 
   }  // end 'GetParticleCharge(int)'
 
@@ -248,7 +242,7 @@ namespace SColdQcdCorrelatorAnalysis {
       ) {
         if ((*hepPar) -> barcode() == barcode) {
           parToGrab = *hepPar;
-          break;
+          return parToGrab;
         }
       }  // end particle loop
     }  // end subevent loop
@@ -256,6 +250,141 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end 'GetHepMCGenParticleFromBarcode(int, PHCompositeNode*)'
 
+
+
+  // truth index methods ------------------------------------------------------
+
+  void Tools::TruthIndex::Reset() {
+
+    // n.b. clear() keeps buckets, so rebuilding doesn't rehash
+    phg4ByBarcode.clear();
+    phg4ByTrackID.clear();
+    hepmcByBarcode.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Tools::TruthIndex::SetEvent(PHCompositeNode* topNode) {
+
+    Reset();
+
+    // index g4 particles
+    PHG4TruthInfoContainer* container = Interfaces::GetTruthContainer(topNode);
+    PHG4TruthInfoContainer::ConstRange particles = container -> GetParticleRange();
+
+    phg4ByBarcode.reserve(container -> size());
+    phg4ByTrackID.reserve(container -> size());
+    for (
+      PHG4TruthInfoContainer::ConstIterator itPar = particles.first;
+      itPar != particles.second;
+      ++itPar
+    ) {
+      // n.b. emplace keeps the first match, like the linear scans
+      phg4ByBarcode.emplace(itPar -> second -> get_barcode(), itPar -> second);
+      phg4ByTrackID.emplace(itPar -> second -> get_track_id(), itPar -> second);
+    }
+
+    // index hepmc particles across all subevents
+    PHHepMCGenEventMap* mcEvtMap = Interfaces::GetMcEventMap(topNode);
+    for (
+      PHHepMCGenEventMap::ConstIter genEvt = mcEvtMap -> begin();
+      genEvt != mcEvtMap -> end();
+      ++genEvt
+    ) {
+      HepMC::GenEvent* event = genEvt -> second -> getEvent();
+      for (
+        HepMC::GenEvent::particle_const_iterator hepPar = event -> particles_begin();
+        hepPar != event -> particles_end();
+        ++hepPar
+      ) {
+        hepmcByBarcode.emplace((*hepPar) -> barcode(), *hepPar);
+      }
+    }  // end subevent loop
+    return;
+
+  }  // end 'SetEvent(PHCompositeNode*)'
+
+
+
+  PHG4Particle* Tools::TruthIndex::GetPHG4ParticleFromBarcode(const int barcode) const {
+
+    unordered_map<int, PHG4Particle*>::const_iterator itPar = phg4ByBarcode.find(barcode);
+    return (itPar != phg4ByBarcode.end()) ? itPar -> second : NULL;
+
+  }  // end 'GetPHG4ParticleFromBarcode(int)'
+
+
+
+  PHG4Particle* Tools::TruthIndex::GetPHG4ParticleFromTrackID(const int id) const {
+
+    unordered_map<int, PHG4Particle*>::const_iterator itPar = phg4ByTrackID.find(id);
+    return (itPar != phg4ByTrackID.end()) ? itPar -> second : NULL;
+
+  }  // end 'GetPHG4ParticleFromTrackID(int)'
+
+
+
+  HepMC::GenParticle* Tools::TruthIndex::GetHepMCGenParticleFromBarcode(const int barcode) const {
+
+    unordered_map<int, HepMC::GenParticle*>::const_iterator itPar = hepmcByBarcode.find(barcode);
+    return (itPar != hepmcByBarcode.end()) ? itPar -> second : NULL;
+
+  }  // end 'GetHepMCGenParticleFromBarcode(int)'
+
+
+
+  // truth index ctor/dtor ----------------------------------------------------
+
+  Tools::TruthIndex::TruthIndex() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Tools::TruthIndex::~TruthIndex() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Tools::TruthIndex::TruthIndex(PHCompositeNode* topNode) {
+
+    SetEvent(topNode);
+
+  }  // end ctor(PHCompositeNode*)
+
+
+
+  // truth index lookups ------------------------------------------------------
+
+  PHG4Particle* Tools::GetPHG4ParticleFromBarcode(const int barcode, const TruthIndex& index) {
+
+    return index.GetPHG4ParticleFromBarcode(barcode);
+
+  }  // end 'GetPHG4ParticleFromBarcode(int, TruthIndex&)'
+
+
+
+  PHG4Particle* Tools::GetPHG4ParticleFromTrackID(const int id, const TruthIndex& index) {
+
+    return index.GetPHG4ParticleFromTrackID(id);
+
+  }  // end 'GetPHG4ParticleFromTrackID(int, TruthIndex&)'
+
+
+
+  HepMC::GenParticle* Tools::GetHepMCGenParticleFromBarcode(const int barcode, const TruthIndex& index) {
+
+    return index.GetHepMCGenParticleFromBarcode(barcode);
+
+  }  // end 'GetHepMCGenParticleFromBarcode(int, TruthIndex&)'
+
 }  // end SColdQcdCorrealtorAnalysis namespace
 
 // end ------------------------------------------------------------------------
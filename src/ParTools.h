@@ -17,6 +17,7 @@
 #include <cmath>
 #include <vector>
 #include <optional>
+#include <unordered_map>
 // phool libraries
 #include <phool/PHCompositeNode.h>
 // PHG4 libraries
@@ -59,6 +60,45 @@ namespace SColdQcdCorrelatorAnalysis {
     PHG4Particle*       GetPHG4ParticleFromTrackID(const int id, PHCompositeNode* topNode);
     HepMC::GenParticle* GetHepMCGenParticleFromBarcode(const int barcode, PHCompositeNode* topNode);
 
+
+
+    // event-scoped truth index -----------------------------------------------
+
+    class TruthIndex {
+
+      private:
+
+        // data members
+        unordered_map<int, PHG4Particle*>       phg4ByBarcode;
+        unordered_map<int, PHG4Particle*>       phg4ByTrackID;
+        unordered_map<int, HepMC::GenParticle*> hepmcByBarcode;
+
+      public:
+
+        // public methods
+        void                Reset();
+        void                SetEvent(PHCompositeNode* topNode);
+        PHG4Particle*       GetPHG4ParticleFromBarcode(const int barcode) const;
+        PHG4Particle*       GetPHG4ParticleFromTrackID(const int id) const;
+        HepMC::GenParticle* GetHepMCGenParticleFromBarcode(const int barcode) const;
+
+        // default ctor/dtor
+        TruthIndex();
+        ~TruthIndex();
+
+        // ctor accepting arguments
+        TruthIndex(PHCompositeNode* topNode);
+
+    };  // end TruthIndex definition
+
+
+
+    // truth index lookups ----------------------------------------------------
+
+    PHG4Particle*       GetPHG4ParticleFromBarcode(const int barcode, const TruthIndex& index);
+    PHG4Particle*       GetPHG4ParticleFromTrackID(const int id, const TruthIndex& index);
+    HepMC::GenParticle* GetHepMCGenParticleFromBarcode(const int barcode, const TruthIndex& index);
+
   }  // end Tools namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
 
@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------------
+// 'ParallelTreeProcessor.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Multithreaded event loop over a TChain, with one chain
+// per worker thread and cluster-aligned entry ranges.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_PARALLELTREEPROCESSOR_CC
+
+// class definition
+#include "ParallelTreeProcessor.h"
+
+// c++ utilities
+#include <atomic>
+#include <thread>
+#include <cassert>
+#include <algorithm>
+// root libraries
+#include <TROOT.h>
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // ParallelTreeProcessor internal methods -----------------------------------
+
+  TChain* Interfaces::ParallelTreeProcessor::MakeChain() const {
+
+    TChain* chain = new TChain(treeName.data());
+    for (const string& file : files) {
+      chain -> Add(file.data());
+    }
+    return chain;
+
+  }  // end 'MakeChain()'
+
+
+
+  void Interfaces::ParallelTreeProcessor::MakeRanges() {
+
+    // n.b. GetEntries() also fills the chain's tree offsets
+    TChain*        chain    = MakeChain();
+    const int64_t  nEntries = chain -> GetEntries();
+    const int64_t* offsets  = chain -> GetTreeOffset();
+
+    // collect cluster boundaries across all trees in chain, so that
+    // no two workers ever decompress the same basket
+    vector<int64_t> boundaries;
+    for (int iTree = 0; iTree < chain -> GetNtrees(); ++iTree) {
+
+      // skip empty trees: loading their offset would load the next one
+      if (offsets[iTree + 1] == offsets[iTree]) continue;
+      if (chain -> LoadTree(offsets[iTree]) < 0) continue;
+
+      TTree*                  tree         = chain -> GetTree();
+      const int64_t           nTreeEntries = tree -> GetEntries();
+      TTree::TClusterIterator clusters     = tree -> GetClusterIterator(0);
+      while (clusters.Next() < nTreeEntries) {
+        boundaries.push_back(offsets[iTree] + min(clusters.GetNextEntry(), nTreeEntries));
+      }
+    }
+    delete chain;
+
+    // group consecutive clusters into roughly equal ranges
+    const size_t nRanges = max(nThreads * nRangesPerThread, (size_t) 1);
+    const double target  = (double) nEntries / (double) nRanges;
+
+    ranges.clear();
+    int64_t first = 0;
+    for (const int64_t boundary : boundaries) {
+      if ((double) (boundary - first) >= target) {
+        ranges.emplace_back(first, boundary);
+        first = boundary;
+      }
+    }
+    if (first < nEntries) {
+      ranges.emplace_back(first, nEntries);
+    }
+    return;
+
+  }  // end 'MakeRanges()'
+
+
+
+  // ParallelTreeProcessor public methods -------------------------------------
+
+  void Interfaces::ParallelTreeProcessor::Run(BindHook bind, ProcessHook process, ReduceHook reduce) {
+
+    // n.b. needed before chains are opened on several threads
+    ROOT::EnableThreadSafety();
+
+    // workers pull ranges off a shared counter until none are left
+    atomic<size_t> nextRange {0};
+    auto work = [&](const size_t iThread) {
+
+      TChain* chain = MakeChain();
+      if (bind) bind(chain, iThread);
+
+      int current = -1;
+      for (size_t iRange = nextRange.fetch_add(1); iRange < ranges.size(); iRange = nextRange.fetch_add(1)) {
+        for (int64_t entry = ranges[iRange].first; entry < ranges[iRange].second; ++entry) {
+
+          const int64_t status = Interfaces::LoadTree(chain, entry, current);
+          if (status < 0) {
+            cerr << PHWHERE << "WARNING: couldn't load entry " << entry << " of tree '" << treeName << "' (status = " << status << ")! Skipping rest of range." << endl;
+            break;
+          }
+          Interfaces::GetEntry(chain, entry);
+          process(chain, entry, iThread);
+        }
+      }
+      delete chain;
+    };
+
+    vector<thread> workers;
+    for (size_t iThread = 0; iThread < nThreads; ++iThread) {
+      workers.emplace_back(work, iThread);
+    }
+    for (thread& worker : workers) {
+      worker.join();
+    }
+
+    // merge results sequentially so reduce needs no locking
+    if (reduce) {
+      for (size_t iThread = 0; iThread < nThreads; ++iThread) {
+        reduce(iThread);
+      }
+    }
+    return;
+
+  }  // end 'Run(BindHook, ProcessHook, ReduceHook)'
+
+
+
+  // ParallelTreeProcessor ctor/dtor ------------------------------------------
+
+  Interfaces::ParallelTreeProcessor::ParallelTreeProcessor() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Interfaces::ParallelTreeProcessor::~ParallelTreeProcessor() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Interfaces::ParallelTreeProcessor::ParallelTreeProcessor(
+    const string& arg_tree,
+    const vector<string>& arg_files,
+    const size_t arg_nThreads,
+    const size_t arg_nRangesPerThread
+  ) {
+
+    // make sure there's something to process
+    if (arg_files.empty()) {
+      cerr << PHWHERE << "PANIC: no input files given for tree '" << arg_tree << "'!" << endl;
+      assert(!arg_files.empty());
+    }
+
+    treeName         = arg_tree;
+    files            = arg_files;
+    nThreads         = (arg_nThreads > 0) ? arg_nThreads : max(thread::hardware_concurrency(), 1U);
+    nRangesPerThread = max(arg_nRangesPerThread, (size_t) 1);
+    MakeRanges();
+
+  }  // end ctor(string&, vector<string>&, size_t, size_t)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// 'ParallelTreeProcessor.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Multithreaded event loop over a TChain, with one chain
+// per worker thread and cluster-aligned entry ranges.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_PARALLELTREEPROCESSOR_H
+#define SCORRELATORUTILITIES_PARALLELTREEPROCESSOR_H
+
+// c++ utilities
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <iostream>
+#include <functional>
+// root libraries
+#include <TTree.h>
+#include <TChain.h>
+// phool libraries
+#include <phool/phool.h>
+// analysis utilities
+#include "TreeInterfaces.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Interfaces {
+
+    // parallel tree processor definition -------------------------------------
+
+    // n.b. each worker gets its own chain, so per-thread state (Info
+    // buffers, histograms, etc.) should be indexed by iThread; hooks
+    // are called as:
+    //   - bind(chain, iThread):           once per worker, before any entries
+    //   - process(chain, entry, iThread): once per entry, on the worker
+    //   - reduce(iThread):                once per worker, on the calling
+    //                                     thread and in thread order
+    class ParallelTreeProcessor {
+
+      public:
+
+        // hooks
+        using BindHook    = function<void(TChain*, const size_t)>;
+        using ProcessHook = function<void(TChain*, const int64_t, const size_t)>;
+        using ReduceHook  = function<void(const size_t)>;
+
+      private:
+
+        // inputs
+        string         treeName;
+        vector<string> files;
+        size_t         nThreads         = 1;
+        size_t         nRangesPerThread = 4;
+
+        // entry ranges: [first, last)
+        vector<pair<int64_t, int64_t>> ranges;
+
+        // internal methods
+        TChain* MakeChain() const;
+        void    MakeRanges();
+
+      public:
+
+        // getters
+        size_t                                GetNThreads() const {return nThreads;}
+        const vector<pair<int64_t, int64_t>>& GetRanges()   const {return ranges;}
+
+        // public methods
+        void Run(BindHook bind, ProcessHook process, ReduceHook reduce = nullptr);
+
+        // default ctor/dtor
+        ParallelTreeProcessor();
+        ~ParallelTreeProcessor();
+
+        // ctor accepting arguments: n.b. nThreads = 0 uses all cores, and
+        // ranges are over-split by nRangesPerThread to balance the load
+        ParallelTreeProcessor(
+          const string& arg_tree,
+          const vector<string>& arg_files,
+          const size_t arg_nThreads = 0,
+          const size_t arg_nRangesPerThread = 4
+        );
+
+    };  // end ParallelTreeProcessor definition
+
+  }  // end Interfaces namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -69,18 +69,18 @@ namespace SColdQcdCorrelatorAnalysis {
 
   void Types::RecoInfo::SetInfo(PHCompositeNode* topNode) {
 
-    // get sums
-    nTrks     = Tools::GetNumTrks(topNode);
-    pSumTrks  = Tools::GetSumTrkMomentum(topNode);
-    eSumEMCal = Tools::GetSumCaloEne(topNode, "CLUSTER_CEMC");
-    eSumIHCal = Tools::GetSumCaloEne(topNode, "CLUSTER_HCALIN");
-    eSumOHCal = Tools::GetSumCaloEne(topNode, "CLUSTER_HCALOUT");
+    // get sums in a single pass
+    const Tools::RecoEventSummary summary = Tools::GetRecoEventSummary(topNode);
+    nTrks     = summary.nTrks;
+    pSumTrks  = summary.pSumTrks;
+    eSumEMCal = summary.GetSumCaloEne(Const::Subsys::EMCal);
+    eSumIHCal = summary.GetSumCaloEne(Const::Subsys::IHCal);
+    eSumOHCal = summary.GetSumCaloEne(Const::Subsys::OHCal);
 
     // get vertex
-    ROOT::Math::XYZVector vtx = Interfaces::GetRecoVtx(topNode);
-    vx = vtx.x();
-    vy = vtx.y();
-    vz = vtx.z();
+    vx = summary.vtx.x();
+    vy = summary.vtx.y();
+    vz = summary.vtx.z();
     vr = hypot(vx, vy);
     return;
 
@@ -109,6 +109,26 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  vector<Types::MemberLayout> Types::RecoInfo::GetMemberLayout() {
+
+    // n.b. same order and names as GetListOfMembers()
+    vector<MemberLayout> layout = {
+      {"nTrks",     offsetof(RecoInfo, nTrks),     Const::Leaf::Int},
+      {"pSumTrks",  offsetof(RecoInfo, pSumTrks),  Const::Leaf::Double},
+      {"eSumEMCal", offsetof(RecoInfo, eSumEMCal), Const::Leaf::Double},
+      {"eSumIHCal", offsetof(RecoInfo, eSumIHCal), Const::Leaf::Double},
+      {"eSumOHCal", offsetof(RecoInfo, eSumOHCal), Const::Leaf::Double},
+      {"vx",        offsetof(RecoInfo, vx),        Const::Leaf::Double},
+      {"vy",        offsetof(RecoInfo, vy),        Const::Leaf::Double},
+      {"vz",        offsetof(RecoInfo, vz),        Const::Leaf::Double},
+      {"vr",        offsetof(RecoInfo, vr),        Const::Leaf::Double}
+    };
+    return layout;
+
+  }  // end 'GetMemberLayout()'
+
+
+
   // ctor/dtor ----------------------------------------------------------------
 
   Types::RecoInfo::RecoInfo() {
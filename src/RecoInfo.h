@@ -24,6 +24,7 @@
 // analysis utilities
 #include "Tools.h"
 #include "Constants.h"
+#include "MemberLayout.h"
 #include "Interfaces.h"
 
 // make common namespaces implicit
@@ -84,7 +85,8 @@ namespace SColdQcdCorrelatorAnalysis {
         void SetInfo(PHCompositeNode* topNode);
 
         // static methods
-        static vector<string> GetListOfMembers();
+        static vector<string>       GetListOfMembers();
+        static vector<MemberLayout> GetMemberLayout();
 
         // default ctor/dtor
         RecoInfo();
@@ -19,6 +19,84 @@ using namespace std;
 
 namespace SColdQcdCorrelatorAnalysis {
 
+  // reconstructed event summary ----------------------------------------------
+
+  void Tools::RecoEventSummary::Reset() {
+
+    nTrks       = 0;
+    nTrksAbvMin = 0;
+    pSumTrks    = 0.;
+    eSumCalo.fill(0.);
+    etSumCalo.fill(0.);
+    nClustCalo.fill(0);
+    vtx.SetXYZ(0., 0., 0.);
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  // reco tools ---------------------------------------------------------------
+
+  Tools::RecoEventSummary Tools::GetRecoEventSummary(PHCompositeNode* topNode, const double ptTrkMin) {
+
+    RecoEventSummary summary;
+
+    // grab vertex first, since cluster et depends on it
+    summary.vtx = Interfaces::GetRecoVtx(topNode);
+
+    // single pass over tracks
+    SvtxTrackMap* mapTrks = Interfaces::GetTrackMap(topNode);
+    summary.nTrks = mapTrks -> size();
+    for (
+      SvtxTrackMap::Iter itTrk = mapTrks -> begin();
+      itTrk != mapTrks -> end();
+      ++itTrk
+    ) {
+
+      // grab track
+      SvtxTrack* track = itTrk -> second;
+      if (!track) continue;
+
+      summary.pSumTrks += std::hypot(track -> get_px(), track -> get_py(), track -> get_pz());
+      if (track -> get_pt() > ptTrkMin) {
+        ++summary.nTrksAbvMin;
+      }
+    }  // end track loop
+
+    // single pass over each calorimeter
+    for (size_t iCalo = 0; iCalo < RecoEventSummary::NCalo; ++iCalo) {
+
+      const int                       subsys   = Const::Subsys::EMCal + iCalo;
+      RawClusterContainer::ConstRange clusters = Interfaces::GetClusters(topNode, Const::MapIndexOntoNode()[subsys]);
+      for (
+        RawClusterContainer::ConstIterator itClust = clusters.first;
+        itClust != clusters.second;
+        ++itClust
+      ) {
+
+        // grab cluster
+        const RawCluster* cluster = itClust -> second;
+        if (!cluster) continue;
+
+        // et relative to the reconstructed vertex
+        const double ene  = cluster -> get_energy();
+        const double dx   = cluster -> get_position().x() - summary.vtx.x();
+        const double dy   = cluster -> get_position().y() - summary.vtx.y();
+        const double dz   = cluster -> get_position().z() - summary.vtx.z();
+        const double dist = std::hypot(dx, dy, dz);
+
+        summary.eSumCalo[iCalo]  += ene;
+        summary.etSumCalo[iCalo] += (dist > 0.) ? (ene * std::hypot(dx, dy) / dist) : 0.;
+        ++summary.nClustCalo[iCalo];
+      }  // end cluster loop
+    }  // end calo loop
+    return summary;
+
+  }  // end 'GetRecoEventSummary(PHCompositeNode*, double)'
+
+
+
   int64_t Tools::GetNumTrks(PHCompositeNode* topNode) {
 
     // grab size of track map
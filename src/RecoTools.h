@@ -11,6 +11,7 @@
 #define SCORRELATORUTILITIES_RECOTOOLS_H
 
 // c++ utilities
+#include <array>
 #include <cmath>
 #include <limits>
 #include <string>
@@ -38,8 +39,40 @@ using namespace std;
 namespace SColdQcdCorrelatorAnalysis {
   namespace Tools {
 
+    // reconstructed event summary --------------------------------------------
+
+    struct RecoEventSummary {
+
+      // calorimeters are indexed by subsystem - Const::Subsys::EMCal
+      static constexpr size_t NCalo = 3;
+
+      // track sums
+      int64_t nTrks       = 0;
+      int64_t nTrksAbvMin = 0;
+      double  pSumTrks    = 0.;
+
+      // calo sums
+      array<double, NCalo>  eSumCalo   = {};
+      array<double, NCalo>  etSumCalo  = {};
+      array<int64_t, NCalo> nClustCalo = {};
+
+      // reconstructed vertex
+      ROOT::Math::XYZVector vtx;
+
+      // methods
+      void    Reset();
+      double  GetSumCaloEne(const int subsys) const {return eSumCalo[subsys - Const::Subsys::EMCal];}
+      double  GetSumCaloEt(const int subsys)  const {return etSumCalo[subsys - Const::Subsys::EMCal];}
+      int64_t GetNumClust(const int subsys)   const {return nClustCalo[subsys - Const::Subsys::EMCal];}
+
+    };  // end RecoEventSummary definition
+
+
+
     // reco tools -------------------------------------------------------------
 
+    RecoEventSummary GetRecoEventSummary(PHCompositeNode* topNode, const double ptTrkMin = 0.);
+
     int64_t GetNumTrks(PHCompositeNode* topNode);
     double  GetSumTrkMomentum(PHCompositeNode* topNode);
     double  GetSumCaloEne(PHCompositeNode* topNode, const string store);
@@ -0,0 +1,384 @@
+// ----------------------------------------------------------------------------
+// 'SparseHist.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Sparse multi-differential histogram keyed by a packed
+// 64-bit bin index in an open-addressing hash table.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_SPARSEHIST_CC
+
+// class definition
+#include "SparseHist.h"
+
+// c++ utilities
+#include <algorithm>
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // SparseAxis public methods ------------------------------------------------
+
+  vector<double> Types::SparseAxis::GetEdges() const {
+
+    return isLog ? logAxis.GetEdges() : linAxis.GetEdges();
+
+  }  // end 'GetEdges()'
+
+
+
+  // SparseAxis ctor/dtor -----------------------------------------------------
+
+  Types::SparseAxis::SparseAxis() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::SparseAxis::~SparseAxis() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::SparseAxis::SparseAxis(const LogAxis& axis) {
+
+    isLog   = true;
+    logAxis = axis;
+
+  }  // end ctor(LogAxis&)
+
+
+
+  Types::SparseAxis::SparseAxis(const LinAxis& axis) {
+
+    isLog   = false;
+    linAxis = axis;
+
+  }  // end ctor(LinAxis&)
+
+
+
+  // SparseHist internal methods ----------------------------------------------
+
+  void Types::SparseHist::Allocate(const size_t nReserve) {
+
+    // size table for nReserve bins at load factor 1/2
+    logSize = 1;
+    while (((size_t) 1 << logSize) < (2 * nReserve)) {
+      ++logSize;
+    }
+    keys.assign((size_t) 1 << logSize, EmptyKey);
+    content.assign((size_t) 1 << logSize, 0.);
+    sumw2.assign((size_t) 1 << logSize, 0.);
+    nFilled = 0;
+    return;
+
+  }  // end 'Allocate(size_t)'
+
+
+
+  void Types::SparseHist::Grow() {
+
+    // move old table aside
+    vector<uint64_t> oldKeys;
+    vector<double>   oldContent;
+    vector<double>   oldSumW2;
+    oldKeys.swap(keys);
+    oldContent.swap(content);
+    oldSumW2.swap(sumw2);
+
+    // double size and reinsert
+    ++logSize;
+    keys.assign((size_t) 1 << logSize, EmptyKey);
+    content.assign((size_t) 1 << logSize, 0.);
+    sumw2.assign((size_t) 1 << logSize, 0.);
+    nFilled = 0;
+    for (size_t iSlot = 0; iSlot < oldKeys.size(); ++iSlot) {
+      if (oldKeys[iSlot] != EmptyKey) {
+        Insert(oldKeys[iSlot], oldContent[iSlot], oldSumW2[iSlot], false);
+      }
+    }
+    return;
+
+  }  // end 'Grow()'
+
+
+
+  void Types::SparseHist::Insert(const uint64_t key, const double weight, const double weight2, const bool count) {
+
+    // n.b. guards against a table emptied by a move
+    if (keys.empty()) Allocate(1);
+
+    size_t mask  = keys.size() - 1;
+    size_t iSlot = GetSlot(key);
+    while ((keys[iSlot] != key) && (keys[iSlot] != EmptyKey)) {
+      iSlot = (iSlot + 1) & mask;
+    }
+
+    // new key: n.b. only grow when a bin is actually added, keeping
+    // load factor at or below 1/2
+    if (keys[iSlot] == EmptyKey) {
+      if ((2 * (nFilled + 1)) > keys.size()) {
+        Grow();
+        mask  = keys.size() - 1;
+        iSlot = GetSlot(key);
+        while (keys[iSlot] != EmptyKey) {
+          iSlot = (iSlot + 1) & mask;
+        }
+      }
+      keys[iSlot] = key;
+      ++nFilled;
+    }
+
+    content[iSlot] += weight;
+    sumw2[iSlot]   += weight2;
+    if (count) entries += 1.;
+    return;
+
+  }  // end 'Insert(uint64_t, double, double, bool)'
+
+
+
+  bool Types::SparseHist::IsSelected(const uint64_t key, const vector<pair<size_t, size_t>>& ranges) const {
+
+    for (size_t iAxis = 0; iAxis < min(ranges.size(), axes.size()); ++iAxis) {
+      const size_t bin = GetAxisBin(key, iAxis);
+      if ((bin < ranges[iAxis].first) || (bin > ranges[iAxis].second)) return false;
+    }
+    return true;
+
+  }  // end 'IsSelected(uint64_t, vector<pair<size_t, size_t>>&)'
+
+
+
+  // SparseHist key methods ---------------------------------------------------
+
+  uint64_t Types::SparseHist::GetKey(const double* x) const {
+
+    uint64_t key = 0;
+    for (size_t iAxis = 0; iAxis < axes.size(); ++iAxis) {
+      key |= GetAxisKey(iAxis, x[iAxis]);
+    }
+    return key;
+
+  }  // end 'GetKey(double*)'
+
+
+
+  // SparseHist fill methods --------------------------------------------------
+
+  void Types::SparseHist::FillBatch(const uint64_t* arg_keys, const double* weights, const size_t nFills) {
+
+    // n.b. no reservation up front: a batch usually has far more fills
+    // than distinct bins, so the table only grows as new bins appear
+    for (size_t iFill = 0; iFill < nFills; ++iFill) {
+      FillKey(arg_keys[iFill], weights[iFill]);
+    }
+    return;
+
+  }  // end 'FillBatch(uint64_t*, double*, size_t)'
+
+
+
+  void Types::SparseHist::FillBatch(const size_t iAxis, const double* x, const double* weights, const size_t nFills, const uint64_t baseKey) {
+
+    // n.b. typical use is one axis (e.g. delta-R) varying per pair
+    // on top of per-jet axes (pt, charge, centrality) in baseKey
+    thread_local vector<uint64_t> batchKeys;
+    batchKeys.resize(nFills);
+    for (size_t iFill = 0; iFill < nFills; ++iFill) {
+      batchKeys[iFill] = baseKey | GetAxisKey(iAxis, x[iFill]);
+    }
+    FillBatch(batchKeys.data(), weights, nFills);
+    return;
+
+  }  // end 'FillBatch(size_t, double*, double*, size_t, uint64_t)'
+
+
+
+  // SparseHist public methods ------------------------------------------------
+
+  void Types::SparseHist::Reset() {
+
+    fill(keys.begin(), keys.end(), EmptyKey);
+    fill(content.begin(), content.end(), 0.);
+    fill(sumw2.begin(), sumw2.end(), 0.);
+    nFilled = 0;
+    entries = 0.;
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Types::SparseHist::Add(const SparseHist& other) {
+
+    // adopt other's binning if this histogram doesn't have any yet
+    if (axes.empty() && (nFilled == 0)) {
+      axes   = other.axes;
+      shifts = other.shifts;
+      masks  = other.masks;
+    }
+
+    // make sure binning is compatible
+    if ((other.shifts != shifts) || (other.masks != masks)) {
+      cerr << PHWHERE << "PANIC: trying to add sparse histograms with different binning!" << endl;
+      assert((other.shifts == shifts) && (other.masks == masks));
+    }
+
+    for (size_t iSlot = 0; iSlot < other.keys.size(); ++iSlot) {
+      if (other.keys[iSlot] != EmptyKey) {
+        Insert(other.keys[iSlot], other.content[iSlot], other.sumw2[iSlot], false);
+      }
+    }
+    entries += other.entries;
+    return;
+
+  }  // end 'Add(SparseHist&)'
+
+
+
+  double Types::SparseHist::GetBinContent(const uint64_t key) const {
+
+    if (keys.empty()) return 0.;
+
+    const size_t mask = keys.size() - 1;
+    for (size_t iSlot = GetSlot(key); keys[iSlot] != EmptyKey; iSlot = (iSlot + 1) & mask) {
+      if (keys[iSlot] == key) return content[iSlot];
+    }
+    return 0.;
+
+  }  // end 'GetBinContent(uint64_t)'
+
+
+
+  double Types::SparseHist::GetBinError(const uint64_t key) const {
+
+    if (keys.empty()) return 0.;
+
+    const size_t mask = keys.size() - 1;
+    for (size_t iSlot = GetSlot(key); keys[iSlot] != EmptyKey; iSlot = (iSlot + 1) & mask) {
+      if (keys[iSlot] == key) return sqrt(sumw2[iSlot]);
+    }
+    return 0.;
+
+  }  // end 'GetBinError(uint64_t)'
+
+
+
+  TH1D* Types::SparseHist::ProjectTH1D(const string& name, const size_t iAxis, const vector<pair<size_t, size_t>>& ranges) const {
+
+    const vector<double> edges = axes[iAxis].GetEdges();
+
+    TH1D* hist = new TH1D(name.data(), "", axes[iAxis].GetNBins(), edges.data());
+    hist -> Sumw2();
+
+    // n.b. bins line up with root's, including under/overflow
+    vector<double> projContent(axes[iAxis].GetNBins() + 2, 0.);
+    vector<double> projSumW2(axes[iAxis].GetNBins() + 2, 0.);
+    for (size_t iSlot = 0; iSlot < keys.size(); ++iSlot) {
+      if ((keys[iSlot] == EmptyKey) || !IsSelected(keys[iSlot], ranges)) continue;
+      const size_t bin = GetAxisBin(keys[iSlot], iAxis);
+      projContent[bin] += content[iSlot];
+      projSumW2[bin]   += sumw2[iSlot];
+    }
+    for (size_t iBin = 0; iBin < projContent.size(); ++iBin) {
+      hist -> SetBinContent(iBin, projContent[iBin]);
+      hist -> GetSumw2() -> SetAt(projSumW2[iBin], iBin);
+    }
+    hist -> SetEntries(entries);
+    return hist;
+
+  }  // end 'ProjectTH1D(string&, size_t, vector<pair<size_t, size_t>>&)'
+
+
+
+  TH2D* Types::SparseHist::ProjectTH2D(const string& name, const size_t iAxisX, const size_t iAxisY, const vector<pair<size_t, size_t>>& ranges) const {
+
+    const vector<double> xEdges = axes[iAxisX].GetEdges();
+    const vector<double> yEdges = axes[iAxisY].GetEdges();
+
+    TH2D* hist = new TH2D(name.data(), "", axes[iAxisX].GetNBins(), xEdges.data(), axes[iAxisY].GetNBins(), yEdges.data());
+    hist -> Sumw2();
+
+    // accumulate densely, then map onto root's global bins
+    const size_t   nX = axes[iAxisX].GetNBins() + 2;
+    const size_t   nY = axes[iAxisY].GetNBins() + 2;
+    vector<double> projContent(nX * nY, 0.);
+    vector<double> projSumW2(nX * nY, 0.);
+    for (size_t iSlot = 0; iSlot < keys.size(); ++iSlot) {
+      if ((keys[iSlot] == EmptyKey) || !IsSelected(keys[iSlot], ranges)) continue;
+      const size_t bin = (GetAxisBin(keys[iSlot], iAxisX) * nY) + GetAxisBin(keys[iSlot], iAxisY);
+      projContent[bin] += content[iSlot];
+      projSumW2[bin]   += sumw2[iSlot];
+    }
+    for (size_t xBin = 0; xBin < nX; ++xBin) {
+      for (size_t yBin = 0; yBin < nY; ++yBin) {
+        const int rootBin = hist -> GetBin(xBin, yBin);
+        hist -> SetBinContent(rootBin, projContent[(xBin * nY) + yBin]);
+        hist -> GetSumw2() -> SetAt(projSumW2[(xBin * nY) + yBin], rootBin);
+      }
+    }
+    hist -> SetEntries(entries);
+    return hist;
+
+  }  // end 'ProjectTH2D(string&, size_t, size_t, vector<pair<size_t, size_t>>&)'
+
+
+
+  // SparseHist ctor/dtor -----------------------------------------------------
+
+  Types::SparseHist::SparseHist() {
+
+    Allocate(1);
+
+  }  // end ctor()
+
+
+
+  Types::SparseHist::~SparseHist() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::SparseHist::SparseHist(const vector<SparseAxis>& arg_axes, const size_t nReserve) {
+
+    // give each axis enough bits for its bins plus under/overflow
+    axes = arg_axes;
+    uint32_t nBits = 0;
+    for (const SparseAxis& axis : axes) {
+      uint32_t axisBits = 1;
+      while (((uint64_t) 1 << axisBits) < (axis.GetNBins() + 2)) {
+        ++axisBits;
+      }
+      shifts.push_back(nBits);
+      masks.push_back(((uint64_t) 1 << axisBits) - 1);
+      nBits += axisBits;
+    }
+
+    // make sure everything fits, leaving the top bit free for EmptyKey
+    if (nBits > 63) {
+      cerr << PHWHERE << "PANIC: sparse histogram binning needs " << nBits << " bits, but keys only have 63!" << endl;
+      assert(nBits <= 63);
+    }
+
+    Allocate(nReserve);
+
+  }  // end ctor(vector<SparseAxis>&, size_t)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
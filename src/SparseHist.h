@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// 'SparseHist.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Sparse multi-differential histogram keyed by a packed
+// 64-bit bin index in an open-addressing hash table.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_SPARSEHIST_H
+#define SCORRELATORUTILITIES_SPARSEHIST_H
+
+// c++ utilities
+#include <limits>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <iostream>
+// root libraries
+#include <TH1D.h>
+#include <TH2D.h>
+#include <TArrayD.h>
+// phool libraries
+#include <phool/phool.h>
+// analysis utilities
+#include "CorrHist.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // SparseAxis definition --------------------------------------------------
+
+    // n.b. wraps either a log or a linear axis, with bin 0 as
+    // underflow and bin nBins + 1 as overflow in both cases
+    class SparseAxis {
+
+      private:
+
+        // data members
+        bool    isLog = false;
+        LogAxis logAxis;
+        LinAxis linAxis;
+
+      public:
+
+        // getters
+        bool   IsLog()    const {return isLog;}
+        size_t GetNBins() const {return isLog ? logAxis.GetNBins() : linAxis.GetNBins();}
+
+        // public methods
+        size_t         FindBin(const double x) const {return isLog ? logAxis.FindBin(x) : linAxis.FindBin(x);}
+        vector<double> GetEdges() const;
+
+        // default ctor/dtor
+        SparseAxis();
+        ~SparseAxis();
+
+        // ctors accepting arguments
+        SparseAxis(const LogAxis& axis);
+        SparseAxis(const LinAxis& axis);
+
+    };  // end SparseAxis definition
+
+
+
+    // SparseHist definition --------------------------------------------------
+
+    class SparseHist {
+
+      private:
+
+        // n.b. marks an empty slot; keys never use the top bit
+        static constexpr uint64_t EmptyKey = numeric_limits<uint64_t>::max();
+
+        // axes and how their bins are packed into a key
+        vector<SparseAxis> axes;
+        vector<uint32_t>   shifts;
+        vector<uint64_t>   masks;
+
+        // open-addressing table with linear probing
+        size_t           nFilled  = 0;
+        uint32_t         logSize  = 0;
+        double           entries  = 0.;
+        vector<uint64_t> keys;
+        vector<double>   content;
+        vector<double>   sumw2;
+
+        // internal methods
+        size_t GetSlot(const uint64_t key) const {return (key * 0x9E3779B97F4A7C15ULL) >> (64 - logSize);}
+        void   Allocate(const size_t nReserve);
+        void   Grow();
+        void   Insert(const uint64_t key, const double weight, const double weight2, const bool count);
+        bool   IsSelected(const uint64_t key, const vector<pair<size_t, size_t>>& ranges) const;
+
+      public:
+
+        // getters
+        size_t GetNAxes()   const {return axes.size();}
+        size_t GetNFilled() const {return nFilled;}
+        double GetEntries() const {return entries;}
+        size_t GetNBytes()  const {return keys.size() * (sizeof(uint64_t) + (2 * sizeof(double)));}
+
+        // key methods: n.b. a key is the OR of the per-axis keys, so
+        // keys for slowly-varying axes can be built once and reused
+        uint64_t GetAxisKey(const size_t iAxis, const double x) const {return (uint64_t) axes[iAxis].FindBin(x) << shifts[iAxis];}
+        uint64_t GetKey(const double* x) const;
+        size_t   GetAxisBin(const uint64_t key, const size_t iAxis) const {return (key >> shifts[iAxis]) & masks[iAxis];}
+
+        // fill methods
+        void FillKey(const uint64_t key, const double weight = 1.) {Insert(key, weight, weight * weight, true);}
+        void Fill(const double* x, const double weight = 1.)       {FillKey(GetKey(x), weight);}
+        void FillBatch(const uint64_t* arg_keys, const double* weights, const size_t nFills);
+        void FillBatch(const size_t iAxis, const double* x, const double* weights, const size_t nFills, const uint64_t baseKey);
+
+        // public methods
+        void   Reset();
+        void   Add(const SparseHist& other);
+        double GetBinContent(const uint64_t key) const;
+        double GetBinError(const uint64_t key) const;
+
+        // projections: n.b. ranges holds an inclusive (first, last) bin
+        // range per axis to sum over; leave empty to sum over everything
+        TH1D* ProjectTH1D(const string& name, const size_t iAxis, const vector<pair<size_t, size_t>>& ranges = {}) const;
+        TH2D* ProjectTH2D(const string& name, const size_t iAxisX, const size_t iAxisY, const vector<pair<size_t, size_t>>& ranges = {}) const;
+
+        // default ctor/dtor: n.b. a default-constructed histogram has no
+        // axes, and adopts those of the first histogram added to it
+        SparseHist();
+        ~SparseHist();
+
+        // ctor accepting arguments
+        SparseHist(const vector<SparseAxis>& arg_axes, const size_t nReserve = 1024);
+
+    };  // end SparseHist definition
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -10,7 +10,10 @@
 #define SCORRELATORUTILITIES_TOOLS_H
 
 #include "ClustTools.h"
+#include "CorrTools.h"
+#include "E3CEngine.h"
 #include "GenTools.h"
+#include "JetTools.h"
 #include "ParTools.h"
 #include "RecoTools.h"
 #include "TrkTools.h"
@@ -11,6 +11,25 @@
 // namespace definition
 #include "TreeInterfaces.h"
 
+// c++ utilities
+#include <cstring>
+#include <cassert>
+#include <iostream>
+#include <algorithm>
+#include <type_traits>
+// phool libraries
+#include <phool/phool.h>
+// analysis utilities
+#include "JetInfo.h"
+#include "CstInfo.h"
+#include "GenInfo.h"
+#include "ParInfo.h"
+#include "TrkInfo.h"
+#include "FlowInfo.h"
+#include "RecoInfo.h"
+#include "ClustInfo.h"
+#include "TrkMatchInfo.h"
+
 // make common namespaces implicit
 using namespace std;
 
@@ -62,6 +81,337 @@ namespace SColdQcdCorrelatorAnalysis {
   template int64_t Interfaces::LoadTree(TChain* tree, const uint64_t entry, int& current);
   template int64_t Interfaces::LoadTree(TNtuple* tree, const uint64_t entry, int& current);
 
+
+
+  // branch binding -----------------------------------------------------------
+
+  bool Interfaces::GetLeafType(TTree* tree, const string& branch, Const::Leaf& type) {
+
+    // check for leaf
+    TLeaf* leaf = tree -> GetLeaf(branch.data());
+    if (!leaf) return false;
+
+    // map root's type names onto member types
+    const string name = leaf -> GetTypeName();
+    if      (name == "Bool_t")    type = Const::Leaf::Bool;
+    else if (name == "Int_t")     type = Const::Leaf::Int;
+    else if (name == "Long64_t")  type = Const::Leaf::Int64;
+    else if (name == "UInt_t")    type = Const::Leaf::UInt32;
+    else if (name == "ULong64_t") type = Const::Leaf::UInt64;
+    else if (name == "Float_t")   type = Const::Leaf::Float;
+    else if (name == "Double_t")  type = Const::Leaf::Double;
+    else                          return false;
+    return true;
+
+  }  // end 'GetLeafType(TTree*, string&, Const::Leaf&)'
+
+
+
+  template <typename TInfo> vector<Types::MemberLayout> Interfaces::SelectInfoBranches(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag) {
+
+    // check for tree
+    if (!tree) {
+      cerr << PHWHERE << "PANIC: trying to bind branches '" << prefix << "*" << tag << "' without a tree!" << endl;
+      assert(tree);
+    }
+
+    // switch each member's branch on or off
+    vector<Types::MemberLayout> selected;
+    for (const Types::MemberLayout& member : TInfo::GetMemberLayout()) {
+      const string branch = prefix + member.name + tag;
+      if (!tree -> GetBranch(branch.data())) continue;
+
+      const bool isSelected = fields.empty() || (find(fields.begin(), fields.end(), member.name) != fields.end());
+      tree -> SetBranchStatus(branch.data(), isSelected);
+      if (isSelected) {
+        selected.push_back(member);
+      }
+    }
+
+    // flag requested fields that couldn't be found
+    for (const string& field : fields) {
+      const bool isFound = any_of(
+        selected.begin(),
+        selected.end(),
+        [&field](const Types::MemberLayout& member) {return member.name == field;}
+      );
+      if (!isFound) {
+        cerr << PHWHERE << "WARNING: no branch '" << prefix << field << tag << "' in tree '" << tree -> GetName() << "' to bind!" << endl;
+      }
+    }
+    return selected;
+
+  }  // end 'SelectInfoBranches(TTree*, string&, vector<string>&, string&)'
+
+
+
+  // InfoBinding internal methods ---------------------------------------------
+
+  template <typename TInfo> void Interfaces::InfoBinding<TInfo>::Clear() {
+
+    // n.b. detach the tree first so it never reads into stale addresses
+    if (tree) {
+      for (const string& branch : branches) {
+        tree -> ResetBranchAddress(tree -> GetBranch(branch.data()));
+      }
+    }
+    tree = NULL;
+    info = NULL;
+    branches.clear();
+    staged.clear();
+    return;
+
+  }  // end 'Clear()'
+
+
+
+  // InfoBinding public methods -----------------------------------------------
+
+  template <typename TInfo> void Interfaces::InfoBinding<TInfo>::Bind(TTree* arg_tree, const string& prefix, TInfo& arg_info, const vector<string>& fields, const string& tag) {
+
+    Clear();
+    tree = arg_tree;
+    info = &arg_info;
+
+    // sort members into those read directly and those needing staging
+    vector<pair<Types::MemberLayout, Const::Leaf>> direct;
+    for (const Types::MemberLayout& member : SelectInfoBranches<TInfo>(tree, prefix, fields, tag)) {
+      const string branch = prefix + member.name + tag;
+
+      Const::Leaf type = member.leaf;
+      if (!GetLeafType(tree, branch, type)) {
+        cerr << PHWHERE << "WARNING: branch '" << branch << "' has an unsupported leaf type! Not binding it." << endl;
+        tree -> SetBranchStatus(branch.data(), false);
+        continue;
+      }
+
+      if (type == member.leaf) {
+        direct.push_back({member, type});
+      } else {
+        Staged stage {member, Scalar()};
+        Types::VisitLeaf(
+          type,
+          [&stage](auto* leafTag) {
+            using Leaf = remove_pointer_t<decltype(leafTag)>;
+            stage.value = Leaf();
+          }
+        );
+        staged.push_back(stage);
+      }
+    }
+
+    // point matching branches straight at their member
+    char* base = reinterpret_cast<char*>(info);
+    for (const auto& [member, type] : direct) {
+      const string branch = prefix + member.name + tag;
+      Types::VisitLeaf(
+        type,
+        [&](auto* leafTag) {
+          using Leaf = remove_pointer_t<decltype(leafTag)>;
+          tree -> SetBranchAddress(branch.data(), reinterpret_cast<Leaf*>(base + member.offset));
+        }
+      );
+      branches.push_back(branch);
+    }
+
+    // n.b. staged is complete by now, so scalar addresses stay put
+    for (Staged& stage : staged) {
+      const string branch = prefix + stage.member.name + tag;
+      visit(
+        [&](auto& value) {tree -> SetBranchAddress(branch.data(), &value);},
+        stage.value
+      );
+      branches.push_back(branch);
+    }
+    return;
+
+  }  // end 'Bind(TTree*, string&, TInfo&, vector<string>&, string&)'
+
+
+
+  template <typename TInfo> void Interfaces::InfoBinding<TInfo>::Update() {
+
+    // convert each staged value to its member's type
+    char* base = reinterpret_cast<char*>(info);
+    for (const Staged& stage : staged) {
+      Types::VisitLeaf(
+        stage.member.leaf,
+        [&](auto* leafTag) {
+          using Member = remove_pointer_t<decltype(leafTag)>;
+          const Member value = visit([](const auto raw) {return static_cast<Member>(raw);}, stage.value);
+          memcpy(base + stage.member.offset, &value, sizeof(Member));
+        }
+      );
+    }
+    return;
+
+  }  // end 'Update()'
+
+
+
+  // InfoBinding ctor/dtor ----------------------------------------------------
+
+  template <typename TInfo> Interfaces::InfoBinding<TInfo>::InfoBinding() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  template <typename TInfo> Interfaces::InfoBinding<TInfo>::~InfoBinding() {
+
+    Clear();
+
+  }  // end dtor()
+
+
+
+  // InfoStage internal methods -----------------------------------------------
+
+  template <typename TInfo> void Interfaces::InfoStage<TInfo>::Clear() {
+
+    // n.b. detach the tree first so it never reads into deleted vectors
+    for (Column& column : columns) {
+      if (tree) {
+        tree -> ResetBranchAddress(tree -> GetBranch(column.branch.data()));
+      }
+      visit([](auto* buffer) {delete buffer;}, column.buffer);
+    }
+    tree = NULL;
+    columns.clear();
+    return;
+
+  }  // end 'Clear()'
+
+
+
+  // InfoStage public methods -------------------------------------------------
+
+  template <typename TInfo> size_t Interfaces::InfoStage<TInfo>::GetSize() const {
+
+    // n.b. all columns of an entry have the same length
+    size_t size = 0;
+    if (!columns.empty()) {
+      size = visit([](const auto* buffer) {return buffer -> size();}, columns.front().buffer);
+    }
+    return size;
+
+  }  // end 'GetSize()'
+
+
+
+  template <typename TInfo> void Interfaces::InfoStage<TInfo>::Bind(TTree* arg_tree, const string& prefix, const vector<string>& fields, const string& tag) {
+
+    Clear();
+    tree = arg_tree;
+    for (const Types::MemberLayout& member : SelectInfoBranches<TInfo>(tree, prefix, fields, tag)) {
+      columns.push_back({member, prefix + member.name + tag, Buffer()});
+    }
+
+    // n.b. columns is complete by now, so buffer addresses stay put
+    for (Column& column : columns) {
+      Types::VisitLeaf(
+        column.member.leaf,
+        [&](auto* leafTag) {
+          using Leaf = remove_pointer_t<decltype(leafTag)>;
+          column.buffer = new vector<Leaf>();
+          tree -> SetBranchAddress(column.branch.data(), &get<vector<Leaf>*>(column.buffer));
+        }
+      );
+    }
+    return;
+
+  }  // end 'Bind(TTree*, string&, vector<string>&, string&)'
+
+
+
+  template <typename TInfo> TInfo Interfaces::InfoStage<TInfo>::GetInfo(const size_t iRow) const {
+
+    // n.b. unselected members keep their default values
+    TInfo info;
+    char* base = reinterpret_cast<char*>(&info);
+    for (const Column& column : columns) {
+      Types::VisitLeaf(
+        column.member.leaf,
+        [&](auto* tag) {
+          using Leaf = remove_pointer_t<decltype(tag)>;
+          const Leaf value = (*get<vector<Leaf>*>(column.buffer))[iRow];
+          memcpy(base + column.member.offset, &value, sizeof(Leaf));
+        }
+      );
+    }
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  template <typename TInfo> void Interfaces::InfoStage<TInfo>::Fill(vector<TInfo>& infos) const {
+
+    const size_t size = GetSize();
+
+    infos.clear();
+    infos.reserve(size);
+    for (size_t iRow = 0; iRow < size; ++iRow) {
+      infos.push_back(GetInfo(iRow));
+    }
+    return;
+
+  }  // end 'Fill(vector<TInfo>&)'
+
+
+
+  // InfoStage ctor/dtor ------------------------------------------------------
+
+  template <typename TInfo> Interfaces::InfoStage<TInfo>::InfoStage() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  template <typename TInfo> Interfaces::InfoStage<TInfo>::~InfoStage() {
+
+    Clear();
+
+  }  // end dtor()
+
+
+
+  // explicit instantiations --------------------------------------------------
+
+  template vector<Types::MemberLayout> Interfaces::SelectInfoBranches<Types::ClustInfo>(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag);
+  template vector<Types::MemberLayout> Interfaces::SelectInfoBranches<Types::CstInfo>(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag);
+  template vector<Types::MemberLayout> Interfaces::SelectInfoBranches<Types::FlowInfo>(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag);
+  template vector<Types::MemberLayout> Interfaces::SelectInfoBranches<Types::GenInfo>(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag);
+  template vector<Types::MemberLayout> Interfaces::SelectInfoBranches<Types::JetInfo>(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag);
+  template vector<Types::MemberLayout> Interfaces::SelectInfoBranches<Types::ParInfo>(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag);
+  template vector<Types::MemberLayout> Interfaces::SelectInfoBranches<Types::RecoInfo>(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag);
+  template vector<Types::MemberLayout> Interfaces::SelectInfoBranches<Types::TrkInfo>(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag);
+  template vector<Types::MemberLayout> Interfaces::SelectInfoBranches<Types::TrkMatchInfo>(TTree* tree, const string& prefix, const vector<string>& fields, const string& tag);
+
+  template class Interfaces::InfoBinding<Types::ClustInfo>;
+  template class Interfaces::InfoBinding<Types::CstInfo>;
+  template class Interfaces::InfoBinding<Types::FlowInfo>;
+  template class Interfaces::InfoBinding<Types::GenInfo>;
+  template class Interfaces::InfoBinding<Types::JetInfo>;
+  template class Interfaces::InfoBinding<Types::ParInfo>;
+  template class Interfaces::InfoBinding<Types::RecoInfo>;
+  template class Interfaces::InfoBinding<Types::TrkInfo>;
+  template class Interfaces::InfoBinding<Types::TrkMatchInfo>;
+
+  template class Interfaces::InfoStage<Types::ClustInfo>;
+  template class Interfaces::InfoStage<Types::CstInfo>;
+  template class Interfaces::InfoStage<Types::FlowInfo>;
+  template class Interfaces::InfoStage<Types::GenInfo>;
+  template class Interfaces::InfoStage<Types::JetInfo>;
+  template class Interfaces::InfoStage<Types::ParInfo>;
+  template class Interfaces::InfoStage<Types::RecoInfo>;
+  template class Interfaces::InfoStage<Types::TrkInfo>;
+  template class Interfaces::InfoStage<Types::TrkMatchInfo>;
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 // end ------------------------------------------------------------------------
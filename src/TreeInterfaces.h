@@ -11,10 +11,17 @@
 
 // c++ utilities
 #include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <variant>
 // root libraries
+#include <TLeaf.h>
 #include <TTree.h>
 #include <TChain.h>
 #include <TNtuple.h>
+// analysis utilities
+#include "MemberLayout.h"
 
 // make common namespaces implicit
 using namespace std;
@@ -29,6 +36,130 @@ namespace SColdQcdCorrelatorAnalysis {
     template <typename T> int64_t GetEntry(T* tree, const uint64_t entry);
     template <typename T> int64_t LoadTree(T* tree, const uint64_t entry, int& current);
 
+
+
+    // branch binding ---------------------------------------------------------
+
+    // n.b. branches are named prefix + member + tag, with members as listed
+    // in TInfo::GetListOfMembers() and tag appended as in AddTagToLeaves(),
+    // and an empty fields list selects all of them. Branches of unselected
+    // members are switched off so ROOT never decompresses them; call
+    // tree -> SetBranchStatus("*", 0) first to also drop branches which
+    // don't belong to any info.
+    bool GetLeafType(TTree* tree, const string& branch, Const::Leaf& type);
+    template <typename TInfo> vector<Types::MemberLayout> SelectInfoBranches(TTree* tree, const string& prefix, const vector<string>& fields = {}, const string& tag = "");
+
+
+
+    // InfoBinding definition -------------------------------------------------
+
+    // binds the branches of a flat tree (one value per member) to an info:
+    // branches whose leaf type matches the member are read straight into
+    // it, while any others (e.g. the Float_t leaves of a TNtuple) are read
+    // into a staging scalar and converted by Update() after each GetEntry()
+    template <typename TInfo> class InfoBinding {
+
+      private:
+
+        // staging scalar for a member whose leaf type differs
+        using Scalar = variant<bool, int, int64_t, uint32_t, uint64_t, float, double>;
+        struct Staged {
+          Types::MemberLayout member;
+          Scalar              value;
+        };
+
+        // data members
+        TTree*         tree = NULL;
+        TInfo*         info = NULL;
+        vector<string> branches;
+        vector<Staged> staged;
+
+        // internal methods
+        void Clear();
+
+      public:
+
+        // getters
+        size_t GetNBound()  const {return branches.size();}
+        size_t GetNStaged() const {return staged.size();}
+
+        // public methods
+        void Bind(TTree* arg_tree, const string& prefix, TInfo& arg_info, const vector<string>& fields = {}, const string& tag = "");
+        void Update();
+
+        // default ctor/dtor
+        InfoBinding();
+        ~InfoBinding();
+
+        // not copyable: owns staging scalars bound to a tree
+        InfoBinding(const InfoBinding&)            = delete;
+        InfoBinding& operator=(const InfoBinding&) = delete;
+
+    };  // end InfoBinding definition
+
+
+
+    // InfoStage definition ---------------------------------------------------
+
+    // staging buffers for trees holding one vector per member (e.g. all
+    // the tracks in an event): branches are bound to a vector per selected
+    // member, which are then unpacked row-by-row into infos or an SoA
+    template <typename TInfo> class InfoStage {
+
+      private:
+
+        // one staging vector per selected member
+        using Buffer = variant<
+          vector<bool>*,
+          vector<int>*,
+          vector<int64_t>*,
+          vector<uint32_t>*,
+          vector<uint64_t>*,
+          vector<float>*,
+          vector<double>*
+        >;
+        struct Column {
+          Types::MemberLayout member;
+          string              branch;
+          Buffer              buffer;
+        };
+
+        // data members
+        TTree*         tree = NULL;
+        vector<Column> columns;
+
+        // internal methods
+        void Clear();
+
+      public:
+
+        // getters
+        size_t GetNColumns() const {return columns.size();}
+        size_t GetSize() const;
+
+        // public methods
+        void  Bind(TTree* arg_tree, const string& prefix, const vector<string>& fields = {}, const string& tag = "");
+        TInfo GetInfo(const size_t iRow) const;
+        void  Fill(vector<TInfo>& infos) const;
+
+        // n.b. TSoA is the matching SoA (e.g. TrkInfoSoA for TrkInfo)
+        template <typename TSoA> void FillSoA(TSoA& soa) const {
+          soa.Clear();
+          for (size_t iRow = 0; iRow < GetSize(); ++iRow) {
+            soa.Push(GetInfo(iRow));
+          }
+        }
+
+        // default ctor/dtor
+        InfoStage();
+        ~InfoStage();
+
+        // not copyable: owns staging vectors bound to a tree
+        InfoStage(const InfoStage&)            = delete;
+        InfoStage& operator=(const InfoStage&) = delete;
+
+    };  // end InfoStage definition
+
   }  // end Interfaces namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
 
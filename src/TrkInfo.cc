@@ -92,9 +92,21 @@ namespace SColdQcdCorrelatorAnalysis {
 
   void Types::TrkInfo::SetInfo(SvtxTrack* track, PHCompositeNode* topNode) {
 
+    // resolve vertices once for both the vertex and dca
+    const Interfaces::VtxContext vtxContext(topNode);
+    SetInfo(track, vtxContext);
+    return;
+
+  }  // end 'SetInfo(SvtxTrack*, PHCompositeNode*)'
+
+
+
+  void Types::TrkInfo::SetInfo(SvtxTrack* track, const Interfaces::VtxContext& vtxContext) {
+
     // do relevant calculations
-    const ROOT::Math::XYZVector trkVtx     = Tools::GetTrackVertex(track, topNode);
-    const pair<double, double>  trkDcaPair = Tools::GetTrackDcaPair(track, topNode);
+    const ROOT::Math::XYZVector trkVtx     = Tools::GetTrackVertex(track, vtxContext);
+    const pair<double, double>  trkDcaPair = Tools::GetTrackDcaPair(track, vtxContext);
+    const Tools::TrkHitSummary  trkHits    = Tools::GetTrackHitSummary(track);
 
     // set track info
     id         = track -> get_id();
@@ -112,16 +124,16 @@ namespace SColdQcdCorrelatorAnalysis {
     vz         = trkVtx.z();
     dcaXY      = trkDcaPair.first;
     dcaZ       = trkDcaPair.second;
-    nMvtxLayer = Tools::GetNumLayer(track, Const::Subsys::Mvtx);
-    nInttLayer = Tools::GetNumLayer(track, Const::Subsys::Intt);
-    nTpcLayer  = Tools::GetNumLayer(track, Const::Subsys::Tpc);
-    nMvtxClust = Tools::GetNumClust(track, Const::Subsys::Mvtx);
-    nInttClust = Tools::GetNumClust(track, Const::Subsys::Intt);
-    nTpcClust  = Tools::GetNumClust(track, Const::Subsys::Tpc);
+    nMvtxLayer = trkHits.GetNumLayer(Const::Subsys::Mvtx);
+    nInttLayer = trkHits.GetNumLayer(Const::Subsys::Intt);
+    nTpcLayer  = trkHits.GetNumLayer(Const::Subsys::Tpc);
+    nMvtxClust = trkHits.GetNumClust(Const::Subsys::Mvtx);
+    nInttClust = trkHits.GetNumClust(Const::Subsys::Intt);
+    nTpcClust  = trkHits.GetNumClust(Const::Subsys::Tpc);
     ptErr      = Tools::GetTrackDeltaPt(track);
     return;
 
-  }  // end 'SetInfo(SvtxTrack*, PHCompositeNode*)'
+  }  // end 'SetInfo(SvtxTrack*, Interfaces::VtxContext&)'
 
 
 
@@ -161,6 +173,21 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  bool Types::TrkInfo::IsInSigmaDcaCut(
+    const pair<float, float> nSigCut,
+    const pair<Tools::SigmaDcaModel, Tools::SigmaDcaModel>& sigmaDca
+  ) const {
+
+    // models already clamp pt to the max used in the fits
+    const bool isInDcaRangeXY  = (abs(dcaXY) < (nSigCut.first  * sigmaDca.first.Eval(pt)));
+    const bool isInDcaRangeZ   = (abs(dcaZ)  < (nSigCut.second * sigmaDca.second.Eval(pt)));
+    const bool isInSigmaDcaCut = (isInDcaRangeXY && isInDcaRangeZ);
+    return isInSigmaDcaCut;
+
+  }  // end 'IsInSigmaDcaCut(pair<float, float>, pair<Tools::SigmaDcaModel, Tools::SigmaDcaModel>&)'
+
+
+
   bool Types::TrkInfo::IsFromPrimaryVtx(PHCompositeNode* topNode) {
 
     GlobalVertex* primVtx   = Interfaces::GetGlobalVertex(topNode);
@@ -171,6 +198,14 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  bool Types::TrkInfo::IsFromPrimaryVtx(const Interfaces::VtxContext& vtxContext) const {
+
+    return (vtxID == vtxContext.GetPrimaryID());
+
+  }  // end 'IsFromPrimaryVtx(Interfaces::VtxContext&)'
+
+
+
   // static methods -----------------------------------------------------------
 
   vector<string> Types::TrkInfo::GetListOfMembers() {
@@ -205,6 +240,39 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  vector<Types::MemberLayout> Types::TrkInfo::GetMemberLayout() {
+
+    // n.b. same order and names as GetListOfMembers()
+    vector<MemberLayout> layout = {
+      {"id",         offsetof(TrkInfo, id),         Const::Leaf::Int},
+      {"vtxID",      offsetof(TrkInfo, vtxID),      Const::Leaf::Int},
+      {"nMvtxLayer", offsetof(TrkInfo, nMvtxLayer), Const::Leaf::Int},
+      {"nInttLayer", offsetof(TrkInfo, nInttLayer), Const::Leaf::Int},
+      {"nTpcLayer",  offsetof(TrkInfo, nTpcLayer),  Const::Leaf::Int},
+      {"nMvtxClust", offsetof(TrkInfo, nMvtxClust), Const::Leaf::Int},
+      {"nInttClust", offsetof(TrkInfo, nInttClust), Const::Leaf::Int},
+      {"nTpcClust",  offsetof(TrkInfo, nTpcClust),  Const::Leaf::Int},
+      {"eta",        offsetof(TrkInfo, eta),        Const::Leaf::Double},
+      {"phi",        offsetof(TrkInfo, phi),        Const::Leaf::Double},
+      {"px",         offsetof(TrkInfo, px),         Const::Leaf::Double},
+      {"py",         offsetof(TrkInfo, py),         Const::Leaf::Double},
+      {"pz",         offsetof(TrkInfo, pz),         Const::Leaf::Double},
+      {"pt",         offsetof(TrkInfo, pt),         Const::Leaf::Double},
+      {"ene",        offsetof(TrkInfo, ene),        Const::Leaf::Double},
+      {"dcaXY",      offsetof(TrkInfo, dcaXY),      Const::Leaf::Double},
+      {"dcaZ",       offsetof(TrkInfo, dcaZ),       Const::Leaf::Double},
+      {"ptErr",      offsetof(TrkInfo, ptErr),      Const::Leaf::Double},
+      {"quality",    offsetof(TrkInfo, quality),    Const::Leaf::Double},
+      {"vx",         offsetof(TrkInfo, vx),         Const::Leaf::Double},
+      {"vy",         offsetof(TrkInfo, vy),         Const::Leaf::Double},
+      {"vz",         offsetof(TrkInfo, vz),         Const::Leaf::Double}
+    };
+    return layout;
+
+  }  // end 'GetMemberLayout()'
+
+
+
   // overloaded operators -----------------------------------------------------
 
   bool Types::operator <(const TrkInfo& lhs, const TrkInfo& rhs) {
@@ -373,6 +441,14 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end ctor(SvtxTrack*, PHCompositeNode*)'
 
+
+
+  Types::TrkInfo::TrkInfo(SvtxTrack* track, const Interfaces::VtxContext& vtxContext) {
+
+    SetInfo(track, vtxContext);
+
+  }  // end ctor(SvtxTrack*, Interfaces::VtxContext&)'
+
 }  // end SColdQcdCorrelatorAnalysis namespace
 
 // end ------------------------------------------------------------------------
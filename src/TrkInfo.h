@@ -26,6 +26,8 @@
 // analysis utilities
 #include "TrkTools.h"
 #include "Constants.h"
+#include "MemberLayout.h"
+#include "Interfaces.h"
 
 // make common namespaces implicit
 using namespace std;
@@ -122,13 +124,17 @@ namespace SColdQcdCorrelatorAnalysis {
         // public methods
         void Reset();
         void SetInfo(SvtxTrack* track, PHCompositeNode* topNode);
+        void SetInfo(SvtxTrack* track, const Interfaces::VtxContext& vtxContext);
         bool IsInAcceptance(const TrkInfo& minimum, const TrkInfo& maximum) const;
         bool IsInAcceptance(const pair<TrkInfo, TrkInfo>& range) const;
         bool IsInSigmaDcaCut(const pair<float, float> nSigCut, const pair<float, float> ptFitMax, const pair<TF1*, TF1*> fSigmaDca) const;
+        bool IsInSigmaDcaCut(const pair<float, float> nSigCut, const pair<Tools::SigmaDcaModel, Tools::SigmaDcaModel>& sigmaDca) const;
         bool IsFromPrimaryVtx(PHCompositeNode* topNode);
+        bool IsFromPrimaryVtx(const Interfaces::VtxContext& vtxContext) const;
 
         // static methods
-        static vector<string> GetListOfMembers();
+        static vector<string>       GetListOfMembers();
+        static vector<MemberLayout> GetMemberLayout();
 
         // overloaded operators
         friend bool operator <(const TrkInfo& lhs, const TrkInfo& rhs);
@@ -143,6 +149,7 @@ namespace SColdQcdCorrelatorAnalysis {
         // ctors accepting arguments
         TrkInfo(const Const::Init init);
         TrkInfo(SvtxTrack* track, PHCompositeNode* topNode);
+        TrkInfo(SvtxTrack* track, const Interfaces::VtxContext& vtxContext);
 
       // identify this class to ROOT
       ClassDefNV(TrkInfo, 1);
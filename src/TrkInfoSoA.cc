@@ -0,0 +1,319 @@
+// ----------------------------------------------------------------------------
+// 'TrkInfoSoA.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Structure-of-arrays container for track info, with
+// one contiguous column per TrkInfo member.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_TRKINFOSOA_CC
+
+// class definition
+#include "TrkInfoSoA.h"
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // container methods --------------------------------------------------------
+
+  void Types::TrkInfoSoA::Clear() {
+
+    // n.b. clear() keeps capacity, so refilling doesn't reallocate
+    id.clear();
+    vtxID.clear();
+    nMvtxLayer.clear();
+    nInttLayer.clear();
+    nTpcLayer.clear();
+    nMvtxClust.clear();
+    nInttClust.clear();
+    nTpcClust.clear();
+    eta.clear();
+    phi.clear();
+    ene.clear();
+    px.clear();
+    py.clear();
+    pz.clear();
+    pt.clear();
+    dcaXY.clear();
+    dcaZ.clear();
+    ptErr.clear();
+    quality.clear();
+    vx.clear();
+    vy.clear();
+    vz.clear();
+    return;
+
+  }  // end 'Clear()'
+
+
+
+  void Types::TrkInfoSoA::Reserve(const size_t size) {
+
+    id.reserve(size);
+    vtxID.reserve(size);
+    nMvtxLayer.reserve(size);
+    nInttLayer.reserve(size);
+    nTpcLayer.reserve(size);
+    nMvtxClust.reserve(size);
+    nInttClust.reserve(size);
+    nTpcClust.reserve(size);
+    eta.reserve(size);
+    phi.reserve(size);
+    ene.reserve(size);
+    px.reserve(size);
+    py.reserve(size);
+    pz.reserve(size);
+    pt.reserve(size);
+    dcaXY.reserve(size);
+    dcaZ.reserve(size);
+    ptErr.reserve(size);
+    quality.reserve(size);
+    vx.reserve(size);
+    vy.reserve(size);
+    vz.reserve(size);
+    return;
+
+  }  // end 'Reserve(size_t)'
+
+
+
+  void Types::TrkInfoSoA::Push(const TrkInfo& info) {
+
+    id        .push_back(info.GetID());
+    vtxID     .push_back(info.GetVtxID());
+    nMvtxLayer.push_back(info.GetNMvtxLayer());
+    nInttLayer.push_back(info.GetNInttLayer());
+    nTpcLayer .push_back(info.GetNTpcLayer());
+    nMvtxClust.push_back(info.GetNMvtxClust());
+    nInttClust.push_back(info.GetNInttClust());
+    nTpcClust .push_back(info.GetNTpcClust());
+    eta       .push_back(info.GetEta());
+    phi       .push_back(info.GetPhi());
+    ene       .push_back(info.GetEne());
+    px        .push_back(info.GetPX());
+    py        .push_back(info.GetPY());
+    pz        .push_back(info.GetPZ());
+    pt        .push_back(info.GetPT());
+    dcaXY     .push_back(info.GetDcaXY());
+    dcaZ      .push_back(info.GetDcaZ());
+    ptErr     .push_back(info.GetPtErr());
+    quality   .push_back(info.GetQuality());
+    vx        .push_back(info.GetVX());
+    vy        .push_back(info.GetVY());
+    vz        .push_back(info.GetVZ());
+    return;
+
+  }  // end 'Push(TrkInfo&)'
+
+
+
+  void Types::TrkInfoSoA::Fill(const vector<TrkInfo>& infos) {
+
+    Clear();
+    Reserve(infos.size());
+    for (const TrkInfo& info : infos) {
+      Push(info);
+    }
+    return;
+
+  }  // end 'Fill(vector<TrkInfo>&)'
+
+
+
+  Types::TrkInfo Types::TrkInfoSoA::GetInfo(const size_t index) const {
+
+    TrkInfo info;
+    info.SetID(id[index]);
+    info.SetVtxID(vtxID[index]);
+    info.SetNMvtxLayer(nMvtxLayer[index]);
+    info.SetNInttLayer(nInttLayer[index]);
+    info.SetNTpcLayer(nTpcLayer[index]);
+    info.SetNMvtxClust(nMvtxClust[index]);
+    info.SetNInttClust(nInttClust[index]);
+    info.SetNTpcClust(nTpcClust[index]);
+    info.SetEta(eta[index]);
+    info.SetPhi(phi[index]);
+    info.SetEne(ene[index]);
+    info.SetPX(px[index]);
+    info.SetPY(py[index]);
+    info.SetPZ(pz[index]);
+    info.SetPT(pt[index]);
+    info.SetDcaXY(dcaXY[index]);
+    info.SetDcaZ(dcaZ[index]);
+    info.SetPtErr(ptErr[index]);
+    info.SetQuality(quality[index]);
+    info.SetVX(vx[index]);
+    info.SetVY(vy[index]);
+    info.SetVZ(vz[index]);
+    return info;
+
+  }  // end 'GetInfo(size_t)'
+
+
+
+  // batch kernels ------------------------------------------------------------
+
+  void Types::TrkInfoSoA::ApplyCuts(const CutSet<TrkInfo>& cuts, vector<uint8_t>& mask) const {
+
+    const size_t nTrks = Size();
+    mask.assign(nTrks, 1);
+
+    // only loop over columns which actually have a cut
+    for (const CutSet<TrkInfo>::Cut& cut : cuts.GetCuts()) {
+
+      const double min = cut.min;
+      const double max = cut.max;
+      if (const AlignedVector<double>* column = GetDoubleColumn(cut.name)) {
+        const double* values = column -> data();
+        for (size_t iTrk = 0; iTrk < nTrks; ++iTrk) {
+          mask[iTrk] &= (uint8_t) ((values[iTrk] >= min) & (values[iTrk] <= max));
+        }
+      } else if (const AlignedVector<int>* column = GetIntColumn(cut.name)) {
+        const int* values = column -> data();
+        for (size_t iTrk = 0; iTrk < nTrks; ++iTrk) {
+          const double value = values[iTrk];
+          mask[iTrk] &= (uint8_t) ((value >= min) & (value <= max));
+        }
+      }
+    }  // end cut loop
+    return;
+
+  }  // end 'ApplyCuts(CutSet<TrkInfo>&, vector<uint8_t>&)'
+
+
+
+  void Types::TrkInfoSoA::ApplyCuts(const pair<TrkInfo, TrkInfo>& range, vector<uint8_t>& mask) const {
+
+    const CutSet<TrkInfo> cuts(range);
+    ApplyCuts(cuts, mask);
+    return;
+
+  }  // end 'ApplyCuts(pair<TrkInfo, TrkInfo>&, vector<uint8_t>&)'
+
+
+
+  void Types::TrkInfoSoA::ApplySigmaDcaCut(
+    const pair<float, float> nSigCut,
+    const pair<Tools::SigmaDcaModel, Tools::SigmaDcaModel>& sigmaDca,
+    vector<uint8_t>& mask
+  ) const {
+
+    mask.resize(Size());
+    Tools::ApplySigmaDcaCut(pt.data(), dcaXY.data(), dcaZ.data(), mask.data(), Size(), nSigCut, sigmaDca);
+    return;
+
+  }  // end 'ApplySigmaDcaCut(pair<float, float>, pair<Tools::SigmaDcaModel, Tools::SigmaDcaModel>&, vector<uint8_t>&)'
+
+
+
+  void Types::TrkInfoSoA::ComputeEne(const double mass) {
+
+    const size_t  nTrks = Size();
+    const double  mass2 = mass * mass;
+    const double* pxs   = px.data();
+    const double* pys   = py.data();
+    const double* pzs   = pz.data();
+    double*       enes  = ene.data();
+    for (size_t iTrk = 0; iTrk < nTrks; ++iTrk) {
+      enes[iTrk] = sqrt((pxs[iTrk] * pxs[iTrk]) + (pys[iTrk] * pys[iTrk]) + (pzs[iTrk] * pzs[iTrk]) + mass2);
+    }
+    return;
+
+  }  // end 'ComputeEne(double)'
+
+
+
+  void Types::TrkInfoSoA::ComputeDeltaR2(const double etaAxis, const double phiAxis, AlignedVector<double>& dr2) const {
+
+    const size_t  nTrks = Size();
+    const double* etas  = eta.data();
+    const double* phis  = phi.data();
+
+    dr2.resize(nTrks);
+    double* dr2s = dr2.data();
+    for (size_t iTrk = 0; iTrk < nTrks; ++iTrk) {
+
+      // wrap delta-phi into [0, pi]
+      const double dEta    = etas[iTrk] - etaAxis;
+      const double dPhiAbs = fabs(phis[iTrk] - phiAxis);
+      const double dPhi    = (dPhiAbs > M_PI) ? ((2. * M_PI) - dPhiAbs) : dPhiAbs;
+      dr2s[iTrk] = (dEta * dEta) + (dPhi * dPhi);
+    }
+    return;
+
+  }  // end 'ComputeDeltaR2(double, double, AlignedVector<double>&)'
+
+
+
+  // column lookup ------------------------------------------------------------
+
+  const Types::AlignedVector<int>* Types::TrkInfoSoA::GetIntColumn(const string& member) const {
+
+    if (member == "id")         return &id;
+    if (member == "vtxID")      return &vtxID;
+    if (member == "nMvtxLayer") return &nMvtxLayer;
+    if (member == "nInttLayer") return &nInttLayer;
+    if (member == "nTpcLayer")  return &nTpcLayer;
+    if (member == "nMvtxClust") return &nMvtxClust;
+    if (member == "nInttClust") return &nInttClust;
+    if (member == "nTpcClust")  return &nTpcClust;
+    return NULL;
+
+  }  // end 'GetIntColumn(string&)'
+
+
+
+  const Types::AlignedVector<double>* Types::TrkInfoSoA::GetDoubleColumn(const string& member) const {
+
+    if (member == "eta")        return &eta;
+    if (member == "phi")        return &phi;
+    if (member == "ene")        return &ene;
+    if (member == "px")         return &px;
+    if (member == "py")         return &py;
+    if (member == "pz")         return &pz;
+    if (member == "pt")         return &pt;
+    if (member == "dcaXY")      return &dcaXY;
+    if (member == "dcaZ")       return &dcaZ;
+    if (member == "ptErr")      return &ptErr;
+    if (member == "quality")    return &quality;
+    if (member == "vx")         return &vx;
+    if (member == "vy")         return &vy;
+    if (member == "vz")         return &vz;
+    return NULL;
+
+  }  // end 'GetDoubleColumn(string&)'
+
+
+
+  // ctor/dtor ----------------------------------------------------------------
+
+  Types::TrkInfoSoA::TrkInfoSoA() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::TrkInfoSoA::~TrkInfoSoA() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::TrkInfoSoA::TrkInfoSoA(const vector<TrkInfo>& infos) {
+
+    Fill(infos);
+
+  }  // end ctor(vector<TrkInfo>&)
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
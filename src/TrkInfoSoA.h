@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// 'TrkInfoSoA.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Structure-of-arrays container for track info, with
+// one contiguous column per TrkInfo member.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_TRKINFOSOA_H
+#define SCORRELATORUTILITIES_TRKINFOSOA_H
+
+// c++ utilities
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+// analysis utilities
+#include "CutSet.h"
+#include "TrkInfo.h"
+#include "TrkTools.h"
+#include "Constants.h"
+#include "AlignedAllocator.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // TrkInfoSoA definition --------------------------------------------------
+
+    struct TrkInfoSoA {
+
+      // proxy view of a single row
+      class Row {
+
+        private:
+
+          // data members
+          const TrkInfoSoA* soa   = NULL;
+          size_t            index = 0;
+
+        public:
+
+          // getters
+          int    GetID() const         {return soa -> id[index];}
+          int    GetVtxID() const      {return soa -> vtxID[index];}
+          int    GetNMvtxLayer() const {return soa -> nMvtxLayer[index];}
+          int    GetNInttLayer() const {return soa -> nInttLayer[index];}
+          int    GetNTpcLayer() const  {return soa -> nTpcLayer[index];}
+          int    GetNMvtxClust() const {return soa -> nMvtxClust[index];}
+          int    GetNInttClust() const {return soa -> nInttClust[index];}
+          int    GetNTpcClust() const  {return soa -> nTpcClust[index];}
+          double GetEta() const        {return soa -> eta[index];}
+          double GetPhi() const        {return soa -> phi[index];}
+          double GetEne() const        {return soa -> ene[index];}
+          double GetPX() const         {return soa -> px[index];}
+          double GetPY() const         {return soa -> py[index];}
+          double GetPZ() const         {return soa -> pz[index];}
+          double GetPT() const         {return soa -> pt[index];}
+          double GetDcaXY() const      {return soa -> dcaXY[index];}
+          double GetDcaZ() const       {return soa -> dcaZ[index];}
+          double GetPtErr() const      {return soa -> ptErr[index];}
+          double GetQuality() const    {return soa -> quality[index];}
+          double GetVX() const         {return soa -> vx[index];}
+          double GetVY() const         {return soa -> vy[index];}
+          double GetVZ() const         {return soa -> vz[index];}
+
+          // convert row back into a TrkInfo
+          TrkInfo ToInfo() const {return soa -> GetInfo(index);}
+
+          // ctor
+          Row(const TrkInfoSoA* arg_soa, const size_t arg_index) : soa(arg_soa), index(arg_index) {}
+
+      };  // end Row definition
+
+      // columns
+      AlignedVector<int>    id;
+      AlignedVector<int>    vtxID;
+      AlignedVector<int>    nMvtxLayer;
+      AlignedVector<int>    nInttLayer;
+      AlignedVector<int>    nTpcLayer;
+      AlignedVector<int>    nMvtxClust;
+      AlignedVector<int>    nInttClust;
+      AlignedVector<int>    nTpcClust;
+      AlignedVector<double> eta;
+      AlignedVector<double> phi;
+      AlignedVector<double> ene;
+      AlignedVector<double> px;
+      AlignedVector<double> py;
+      AlignedVector<double> pz;
+      AlignedVector<double> pt;
+      AlignedVector<double> dcaXY;
+      AlignedVector<double> dcaZ;
+      AlignedVector<double> ptErr;
+      AlignedVector<double> quality;
+      AlignedVector<double> vx;
+      AlignedVector<double> vy;
+      AlignedVector<double> vz;
+
+      // container methods
+      void    Clear();
+      void    Reserve(const size_t size);
+      void    Push(const TrkInfo& info);
+      void    Fill(const vector<TrkInfo>& infos);
+      size_t  Size() const {return pt.size();}
+      Row     operator[](const size_t index) const {return Row(this, index);}
+      TrkInfo GetInfo(const size_t index) const;
+
+      // batch kernels
+      void ApplyCuts(const CutSet<TrkInfo>& cuts, vector<uint8_t>& mask) const;
+      void ApplyCuts(const pair<TrkInfo, TrkInfo>& range, vector<uint8_t>& mask) const;
+      void ApplySigmaDcaCut(const pair<float, float> nSigCut, const pair<Tools::SigmaDcaModel, Tools::SigmaDcaModel>& sigmaDca, vector<uint8_t>& mask) const;
+      void ComputeEne(const double mass = Const::MassPion());
+      void ComputeDeltaR2(const double etaAxis, const double phiAxis, AlignedVector<double>& dr2) const;
+
+      // column lookup by member name
+      const AlignedVector<int>*    GetIntColumn(const string& member) const;
+      const AlignedVector<double>* GetDoubleColumn(const string& member) const;
+
+      // default ctor/dtor
+      TrkInfoSoA();
+      ~TrkInfoSoA();
+
+      // ctor accepting arguments
+      TrkInfoSoA(const vector<TrkInfo>& infos);
+
+    };  // end TrkInfoSoA definition
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
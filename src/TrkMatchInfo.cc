@@ -0,0 +1,205 @@
+// ----------------------------------------------------------------------------
+// 'TrkMatchInfo.cc'
+// Derek Anderson
+// 10.17.2026
+//
+// Utility classes to hold track-to-truth matches and
+// a per-event table of them.
+// ----------------------------------------------------------------------------
+
+#define SCORRELATORUTILITIES_TRKMATCHINFO_CC
+
+// class definition
+#include "TrkMatchInfo.h"
+
+// make comon namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+
+  // TrkMatchInfo public methods ----------------------------------------------
+
+  void Types::TrkMatchInfo::Reset() {
+
+    trkID   = numeric_limits<int>::max();
+    barcode = numeric_limits<int>::max();
+    nShared = numeric_limits<int>::max();
+    nClust  = numeric_limits<int>::max();
+    purity  = numeric_limits<double>::max();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Types::TrkMatchInfo::SetInfo(
+    const int arg_trkID,
+    const int arg_barcode,
+    const int arg_nShared,
+    const int arg_nClust
+  ) {
+
+    trkID   = arg_trkID;
+    barcode = arg_barcode;
+    nShared = arg_nShared;
+    nClust  = arg_nClust;
+    purity  = (nClust > 0) ? ((double) nShared / (double) nClust) : 0.;
+    return;
+
+  }  // end 'SetInfo(int, int, int, int)'
+
+
+
+  // TrkMatchInfo static methods ----------------------------------------------
+
+  vector<string> Types::TrkMatchInfo::GetListOfMembers() {
+
+    vector<string> members = {
+      "trkID",
+      "barcode",
+      "nShared",
+      "nClust",
+      "purity"
+    };
+    return members;
+
+  }  // end 'GetListOfMembers()'
+
+
+
+  vector<Types::MemberLayout> Types::TrkMatchInfo::GetMemberLayout() {
+
+    // n.b. same order and names as GetListOfMembers()
+    vector<MemberLayout> layout = {
+      {"trkID",   offsetof(TrkMatchInfo, trkID),   Const::Leaf::Int},
+      {"barcode", offsetof(TrkMatchInfo, barcode), Const::Leaf::Int},
+      {"nShared", offsetof(TrkMatchInfo, nShared), Const::Leaf::Int},
+      {"nClust",  offsetof(TrkMatchInfo, nClust),  Const::Leaf::Int},
+      {"purity",  offsetof(TrkMatchInfo, purity),  Const::Leaf::Double}
+    };
+    return layout;
+
+  }  // end 'GetMemberLayout()'
+
+
+
+  // TrkMatchInfo ctor/dtor ---------------------------------------------------
+
+  Types::TrkMatchInfo::TrkMatchInfo() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::TrkMatchInfo::~TrkMatchInfo() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Types::TrkMatchInfo::TrkMatchInfo(
+    const int arg_trkID,
+    const int arg_barcode,
+    const int arg_nShared,
+    const int arg_nClust
+  ) {
+
+    SetInfo(arg_trkID, arg_barcode, arg_nShared, arg_nClust);
+
+  }  // end ctor(int, int, int, int)
+
+
+
+  // TrkMatchTable public methods ---------------------------------------------
+
+  void Types::TrkMatchTable::Reset() {
+
+    matches.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Types::TrkMatchTable::Reserve(const size_t size) {
+
+    matches.reserve(size);
+    return;
+
+  }  // end 'Reserve(size_t)'
+
+
+
+  void Types::TrkMatchTable::Add(const TrkMatchInfo& match) {
+
+    // n.b. call Sort() after adding out of order
+    matches.push_back(match);
+    return;
+
+  }  // end 'Add(TrkMatchInfo&)'
+
+
+
+  void Types::TrkMatchTable::Sort() {
+
+    sort(
+      matches.begin(),
+      matches.end(),
+      [](const TrkMatchInfo& lhs, const TrkMatchInfo& rhs) {return lhs.GetTrkID() < rhs.GetTrkID();}
+    );
+    return;
+
+  }  // end 'Sort()'
+
+
+
+  const Types::TrkMatchInfo* Types::TrkMatchTable::Find(const int trkID) const {
+
+    vector<TrkMatchInfo>::const_iterator itMatch = lower_bound(
+      matches.begin(),
+      matches.end(),
+      trkID,
+      [](const TrkMatchInfo& match, const int id) {return match.GetTrkID() < id;}
+    );
+
+    const bool isFound = ((itMatch != matches.end()) && (itMatch -> GetTrkID() == trkID));
+    return isFound ? &(*itMatch) : NULL;
+
+  }  // end 'Find(int)'
+
+
+
+  int Types::TrkMatchTable::GetMatchID(const int trkID) const {
+
+    const TrkMatchInfo* match = Find(trkID);
+    return match ? match -> GetBarcode() : numeric_limits<int>::max();
+
+  }  // end 'GetMatchID(int)'
+
+
+
+  // TrkMatchTable ctor/dtor --------------------------------------------------
+
+  Types::TrkMatchTable::TrkMatchTable() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Types::TrkMatchTable::~TrkMatchTable() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+// end ------------------------------------------------------------------------
@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// 'TrkMatchInfo.h'
+// Derek Anderson
+// 10.17.2026
+//
+// Utility classes to hold track-to-truth matches and
+// a per-event table of them.
+// ----------------------------------------------------------------------------
+
+#ifndef SCORRELATORUTILITIES_TRKMATCHINFO_H
+#define SCORRELATORUTILITIES_TRKMATCHINFO_H
+
+// c++ utilities
+#include <limits>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+// root libraries
+#include <Rtypes.h>
+// analysis utilities
+#include "MemberLayout.h"
+
+// make common namespaces implicit
+using namespace std;
+
+
+
+namespace SColdQcdCorrelatorAnalysis {
+  namespace Types {
+
+    // TrkMatchInfo definition ------------------------------------------------
+
+    class TrkMatchInfo {
+
+      private:
+
+        // data members
+        int    trkID   = numeric_limits<int>::max();
+        int    barcode = numeric_limits<int>::max();
+        int    nShared = numeric_limits<int>::max();
+        int    nClust  = numeric_limits<int>::max();
+        double purity  = numeric_limits<double>::max();
+
+      public:
+
+        // getters
+        int    GetTrkID()   const {return trkID;}
+        int    GetBarcode() const {return barcode;}
+        int    GetNShared() const {return nShared;}
+        int    GetNClust()  const {return nClust;}
+        double GetPurity()  const {return purity;}
+
+        // setters
+        void SetTrkID(const int arg_trkID)      {trkID   = arg_trkID;}
+        void SetBarcode(const int arg_barcode)  {barcode = arg_barcode;}
+        void SetNShared(const int arg_nShared)  {nShared = arg_nShared;}
+        void SetNClust(const int arg_nClust)    {nClust  = arg_nClust;}
+        void SetPurity(const double arg_purity) {purity  = arg_purity;}
+
+        // public methods
+        void Reset();
+        void SetInfo(const int arg_trkID, const int arg_barcode, const int arg_nShared, const int arg_nClust);
+
+        // static methods
+        static vector<string>       GetListOfMembers();
+        static vector<MemberLayout> GetMemberLayout();
+
+        // default ctor/dtor
+        TrkMatchInfo();
+        ~TrkMatchInfo();
+
+        // ctor accepting arguments
+        TrkMatchInfo(const int arg_trkID, const int arg_barcode, const int arg_nShared, const int arg_nClust);
+
+      // identify this class to ROOT
+      ClassDefNV(TrkMatchInfo, 1)
+
+    };  // end TrkMatchInfo definition
+
+
+
+    // TrkMatchTable definition -----------------------------------------------
+
+    class TrkMatchTable {
+
+      private:
+
+        // data members: n.b. kept sorted by track id
+        vector<TrkMatchInfo> matches;
+
+      public:
+
+        // getters
+        size_t                      GetNMatches() const {return matches.size();}
+        const vector<TrkMatchInfo>& GetMatches()  const {return matches;}
+
+        // public methods
+        void                Reset();
+        void                Reserve(const size_t size);
+        void                Add(const TrkMatchInfo& match);
+        void                Sort();
+        const TrkMatchInfo* Find(const int trkID) const;
+        int                 GetMatchID(const int trkID) const;
+
+        // default ctor/dtor
+        TrkMatchTable();
+        ~TrkMatchTable();
+
+      // identify this class to ROOT
+      ClassDefNV(TrkMatchTable, 1)
+
+    };  // end TrkMatchTable definition
+
+  }  // end Types namespace
+}  // end SColdQcdCorrelatorAnalysis namespace
+
+#endif
+
+// end ------------------------------------------------------------------------
@@ -19,25 +19,33 @@ using namespace std;
 
 namespace SColdQcdCorrelatorAnalysis {
 
-  int Tools::GetNumLayer(SvtxTrack* track, const int16_t sys) {
+  // hit summary methods ------------------------------------------------------
+
+  void Tools::TrkHitSummary::Reset() {
+
+    mvtxLayers = 0;
+    inttLayers = 0;
+    tpcLayers  = 0;
+    nMvtxClust = 0;
+    nInttClust = 0;
+    nTpcClust  = 0;
+    return;
+
+  }  // end 'Reset()'
+
+
 
-    // grab track seed
-    TrackSeed* seed = GetTrackSeed(track, sys);
+  void Tools::TrkHitSummary::AddSeed(TrackSeed* seed, const bool addSilicon, const bool addTpc) {
+
+    // if no seed, nothing to add
+    if (!seed) return;
 
     // set min no. of layers
     const int minInttLayer = Const::NMvtxLayer();
     const int minTpcLayer  = Const::NMvtxLayer() + Const::NInttLayer();
 
-    // initialize hit flags
-    vector<bool> isMvtxLayerHit( Const::NMvtxLayer(), false );
-    vector<bool> isInttLayerHit( Const::NInttLayer(), false );
-    vector<bool> isTpcLayerHit(  Const::NTpcLayer(),  false  );
-
-    // determine which layers were hit
-    int layer     = 0;
-    int mvtxLayer = 0;
-    int inttLayer = 0;
-    int tpcLayer  = 0;
+    // flag layers and count clusters in a single pass
+    int layer = 0;
     for (
       auto itClustKey = (seed -> begin_cluster_keys());
       itClustKey != (seed -> end_cluster_keys());
@@ -48,96 +56,169 @@ namespace SColdQcdCorrelatorAnalysis {
       layer = TrkrDefs::getLayer(*itClustKey);
 
       // increment accordingly
-      switch (sys) {
-        case Const::Subsys::Mvtx:
-          if (layer < Const::NMvtxLayer()) {
-            mvtxLayer                 = layer;
-            isMvtxLayerHit[mvtxLayer] = true;
-          }
-          break;
-        case Const::Subsys::Intt:
-          if ((layer >= minInttLayer) && (layer < minTpcLayer)) {
-            inttLayer                 = layer - minInttLayer;
-            isInttLayerHit[inttLayer] = true;
-          }
-          break;
-        case Const::Subsys::Tpc:
-          if (layer >= minTpcLayer) {
-            tpcLayer                = layer - minTpcLayer;
-            isTpcLayerHit[tpcLayer] = true;
+      if (layer < minInttLayer) {
+        if (addSilicon) {
+          mvtxLayers |= (uint64_t(1) << layer);
+          ++nMvtxClust;
+        }
+      } else if (layer < minTpcLayer) {
+        if (addSilicon) {
+          inttLayers |= (uint64_t(1) << (layer - minInttLayer));
+          ++nInttClust;
+        }
+      } else {
+        if (addTpc) {
+          if ((layer - minTpcLayer) < Const::NTpcLayer()) {
+            tpcLayers |= (uint64_t(1) << (layer - minTpcLayer));
           }
-          break;
-        default:
-          break;
+          ++nTpcClust;
+        }
       }
     }  // end cluster loop
+    return;
+
+  }  // end 'AddSeed(TrackSeed*, bool, bool)'
+
+
+
+  int Tools::TrkHitSummary::GetNumLayer(const int16_t sys) const {
 
-    // get the relevant no. of layers
     int nLayer = 0;
     switch (sys) {
       case Const::Subsys::Mvtx:
-        for (int iMvtxLayer = 0; iMvtxLayer < Const::NMvtxLayer(); iMvtxLayer++) {
-          if (isMvtxLayerHit[iMvtxLayer]) ++nLayer;
-        }
+        nLayer = bitset<64>(mvtxLayers).count();
         break;
       case Const::Subsys::Intt:
-        for (int iInttLayer = 0; iInttLayer < Const::NInttLayer(); iInttLayer++) {
-          if (isInttLayerHit[iInttLayer]) ++nLayer;
-        }
+        nLayer = bitset<64>(inttLayers).count();
         break;
       case Const::Subsys::Tpc:
-        for (int iTpcLayer = 0; iTpcLayer < Const::NTpcLayer(); iTpcLayer++) {
-          if (isTpcLayerHit[iTpcLayer]) ++nLayer;
-        }
+        nLayer = bitset<64>(tpcLayers).count();
         break;
       default:
         break;
     }
     return nLayer;
 
-  }  // end 'GetNumLayer(SvtxTrack*, int16_t)'
+  }  // end 'GetNumLayer(int16_t)'
 
 
 
-  int Tools::GetNumClust(SvtxTrack* track, const int16_t sys) {
+  int Tools::TrkHitSummary::GetNumClust(const int16_t sys) const {
 
-    // grab track seed
-    TrackSeed* seed = GetTrackSeed(track, sys);
+    int nClust = 0;
+    switch (sys) {
+      case Const::Subsys::Mvtx:
+        nClust = nMvtxClust;
+        break;
+      case Const::Subsys::Intt:
+        nClust = nInttClust;
+        break;
+      case Const::Subsys::Tpc:
+        nClust = nTpcClust;
+        break;
+      default:
+        break;
+    }
+    return nClust;
 
-    // set min no. of layers
-    const int minInttLayer = Const::NMvtxLayer();
-    const int minTpcLayer  = Const::NMvtxLayer() + Const::NInttLayer();
+  }  // end 'GetNumClust(int16_t)'
 
-    // determine no. of clusters for a given layer
-    int layer    = 0;
-    int nCluster = 0;
-    for (auto itClustKey = (seed -> begin_cluster_keys()); itClustKey != (seed -> end_cluster_keys()); ++itClustKey) {
 
-      // grab layer number
-      layer = TrkrDefs::getLayer(*itClustKey);
 
-      // increment accordingly
-      switch (sys) {
-        case Const::Subsys::Mvtx:
-          if (layer < Const::NMvtxLayer()) {
-            ++nCluster;
-          }
-          break;
-        case Const::Subsys::Intt:
-          if ((layer >= minInttLayer) && (layer < minTpcLayer)) {
-            ++nCluster;
-          }
-          break;
-        case Const::Subsys::Tpc:
-          if (layer >= minTpcLayer) {
-            ++nCluster;
-          }
-          break;
-        default:
-          break;
-      }
-    }  // end cluster loop
-    return nCluster;
+  // dca batch methods --------------------------------------------------------
+
+  void Tools::TrkDcaBatch::Clear() {
+
+    tracks.clear();
+    ids.clear();
+    dcaXY.clear();
+    dcaZ.clear();
+    errXY.clear();
+    errZ.clear();
+    return;
+
+  }  // end 'Clear()'
+
+
+
+  void Tools::TrkDcaBatch::Resize(const size_t size) {
+
+    tracks.resize(size);
+    ids.resize(size);
+    dcaXY.resize(size);
+    dcaZ.resize(size);
+    errXY.resize(size);
+    errZ.resize(size);
+    return;
+
+  }  // end 'Resize(size_t)'
+
+
+
+  // sigma-dca model methods --------------------------------------------------
+
+  void Tools::SigmaDcaModel::SetParams(const TF1* func) {
+
+    // make sure function has the expected no. of parameters
+    const bool isFuncGood = (func && (func -> GetNpar() >= 3));
+    if (!isFuncGood) {
+      cerr << PHWHERE
+           << "PANIC: sigma dca function is missing or doesn't have 3 parameters!"
+           << endl;
+      assert(isFuncGood);
+    }
+
+    par0 = func -> GetParameter(0);
+    par1 = func -> GetParameter(1);
+    par2 = func -> GetParameter(2);
+    return;
+
+  }  // end 'SetParams(TF1*)'
+
+
+
+  TF1* Tools::SigmaDcaModel::MakeTF1(const string name, const pair<float, float> range) const {
+
+    const vector<float> params = {(float) par0, (float) par1, (float) par2};
+    return Interfaces::GetSigmaDcaTF1(name, params, range);
+
+  }  // end 'MakeTF1(string, pair<float, float>)'
+
+
+
+  Tools::SigmaDcaModel::SigmaDcaModel(const vector<float> params, const double ptFitMax) {
+
+    par0  = params.at(0);
+    par1  = params.at(1);
+    par2  = params.at(2);
+    ptMax = ptFitMax;
+
+  }  // end ctor(vector<float>, double)
+
+
+
+  Tools::SigmaDcaModel::SigmaDcaModel(const TF1* func, const double ptFitMax) {
+
+    SetParams(func);
+    ptMax = ptFitMax;
+
+  }  // end ctor(TF1*, double)
+
+
+
+  // track methods ------------------------------------------------------------
+
+  int Tools::GetNumLayer(SvtxTrack* track, const int16_t sys) {
+
+    return GetTrackHitSummary(track).GetNumLayer(sys);
+
+  }  // end 'GetNumLayer(SvtxTrack*, int16_t)'
+
+
+
+  int Tools::GetNumClust(SvtxTrack* track, const int16_t sys) {
+
+    return GetTrackHitSummary(track).GetNumClust(sys);
 
   }  // end 'GetNumClust(SvtxTrack*, int16_t)'
 
@@ -161,6 +242,14 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  int Tools::GetMatchID(SvtxTrack* track, const Types::TrkMatchTable& table) {
+
+    return table.GetMatchID(track -> get_id());
+
+  }  // end 'GetMatchID(SvtxTrack*, Types::TrkMatchTable&)'
+
+
+
   bool Tools::IsGoodTrackSeed(SvtxTrack* track, const bool requireSiSeeds) {
 
     // get track seeds
@@ -195,6 +284,15 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  bool Tools::IsFromPrimaryVtx(SvtxTrack* track, const Interfaces::VtxContext& vtxContext) {
+
+    const int vtxID = (int) track -> get_vertex_id();
+    return (vtxID == vtxContext.GetPrimaryID());
+
+  }  // end 'IsFromPrimaryVtx(SvtxTrack*, Interfaces::VtxContext&)'
+
+
+
   double Tools::GetTrackDeltaPt(SvtxTrack* track) {
 
     // grab covariances
@@ -232,6 +330,19 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  pair<double, double> Tools::GetTrackDcaPair(SvtxTrack* track, const Interfaces::VtxContext& vtxContext) {
+
+    // primary vertex is already cached as an acts vector
+    Acts::Vector3 actsVtx = vtxContext.GetPrimaryPos();
+
+    // return dca
+    const auto dcaAndErr = TrackAnalysisUtils::get_dca(track, actsVtx);
+    return make_pair(dcaAndErr.first.first, dcaAndErr.second.first);
+
+  }  // end 'GetTrackDcaPair(SvtxTrack*, Interfaces::VtxContext&)'
+
+
+
   TrackSeed* Tools::GetTrackSeed(SvtxTrack* track, const int16_t sys) {
 
     // get both track seeds
@@ -265,6 +376,27 @@ namespace SColdQcdCorrelatorAnalysis {
 
 
 
+  Tools::TrkHitSummary Tools::GetTrackHitSummary(SvtxTrack* track) {
+
+    // get both track seeds
+    TrackSeed* trkSiSeed  = track -> get_silicon_seed();
+    TrackSeed* trkTpcSeed = track -> get_tpc_seed();
+
+    // silicon layers come from the silicon seed when present and from
+    // the tpc seed otherwise (cf. 'GetTrackSeed(SvtxTrack*, int16_t)')
+    TrkHitSummary summary;
+    if (trkSiSeed) {
+      summary.AddSeed(trkSiSeed,  true,  false);
+      summary.AddSeed(trkTpcSeed, false, true);
+    } else {
+      summary.AddSeed(trkTpcSeed, true, true);
+    }
+    return summary;
+
+  }  // end 'GetTrackHitSummary(SvtxTrack*)'
+
+
+
   ROOT::Math::XYZVector Tools::GetTrackVertex(SvtxTrack* track, PHCompositeNode* topNode) {
 
     // get vertex associated with track
@@ -277,6 +409,247 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end 'GetTrackVertex(SvtxTrack*, PHCompositeNode*)'
 
+
+
+  ROOT::Math::XYZVector Tools::GetTrackVertex(SvtxTrack* track, const Interfaces::VtxContext& vtxContext) {
+
+    const int vtxID = (int) track -> get_vertex_id();
+    return vtxContext.GetVertexPos(vtxID);
+
+  }  // end 'GetTrackVertex(SvtxTrack*, Interfaces::VtxContext&)'
+
+
+
+  // batch track methods ------------------------------------------------------
+
+  void Tools::ApplySigmaDcaCut(
+    const double* __restrict__ pt,
+    const double* __restrict__ dcaXY,
+    const double* __restrict__ dcaZ,
+    uint8_t* __restrict__ mask,
+    const size_t nTrks,
+    const pair<float, float> nSigCut,
+    const pair<SigmaDcaModel, SigmaDcaModel>& sigmaDca
+  ) {
+
+    // copy parameters into locals so the loop below has no aliasing
+    // and can be auto-vectorized
+    const double nSigXY  = nSigCut.first;
+    const double nSigZ   = nSigCut.second;
+    const double parXY0  = sigmaDca.first.par0;
+    const double parXY1  = sigmaDca.first.par1;
+    const double parXY2  = sigmaDca.first.par2;
+    const double ptMaxXY = sigmaDca.first.ptMax;
+    const double parZ0   = sigmaDca.second.par0;
+    const double parZ1   = sigmaDca.second.par1;
+    const double parZ2   = sigmaDca.second.par2;
+    const double ptMaxZ  = sigmaDca.second.ptMax;
+
+    for (size_t iTrk = 0; iTrk < nTrks; ++iTrk) {
+
+      // if above max pt used to fit dca width, use value of fit at max pt
+      const double ptEvalXY = (pt[iTrk] > ptMaxXY) ? ptMaxXY : pt[iTrk];
+      const double ptEvalZ  = (pt[iTrk] > ptMaxZ)  ? ptMaxZ  : pt[iTrk];
+
+      // evaluate widths
+      const double sigmaXY = parXY0 + (parXY1 / ptEvalXY) + (parXY2 / (ptEvalXY * ptEvalXY));
+      const double sigmaZ  = parZ0  + (parZ1  / ptEvalZ)  + (parZ2  / (ptEvalZ  * ptEvalZ));
+
+      // check if dca is in cut
+      const bool isInDcaRangeXY = (fabs(dcaXY[iTrk]) < (nSigXY * sigmaXY));
+      const bool isInDcaRangeZ  = (fabs(dcaZ[iTrk])  < (nSigZ  * sigmaZ));
+      mask[iTrk] = (uint8_t) (isInDcaRangeXY & isInDcaRangeZ);
+    }
+    return;
+
+  }  // end 'ApplySigmaDcaCut(double*, double*, double*, uint8_t*, size_t, pair<float, float>, pair<SigmaDcaModel, SigmaDcaModel>&)'
+
+
+
+  void Tools::ApplySigmaDcaCut(
+    const vector<double>& pt,
+    const vector<double>& dcaXY,
+    const vector<double>& dcaZ,
+    vector<uint8_t>& mask,
+    const pair<float, float> nSigCut,
+    const pair<SigmaDcaModel, SigmaDcaModel>& sigmaDca
+  ) {
+
+    mask.resize(pt.size());
+    ApplySigmaDcaCut(pt.data(), dcaXY.data(), dcaZ.data(), mask.data(), pt.size(), nSigCut, sigmaDca);
+    return;
+
+  }  // end 'ApplySigmaDcaCut(vector<double>&, vector<double>&, vector<double>&, vector<uint8_t>&, pair<float, float>, pair<SigmaDcaModel, SigmaDcaModel>&)'
+
+
+
+  void Tools::ComputeDcaBatch(
+    SvtxTrackMap* mapTrks,
+    const Acts::Vector3& vtx,
+    TrkDcaBatch& batch,
+    const size_t nThreads
+  ) {
+
+    // collect tracks into a contiguous list
+    batch.Clear();
+    batch.tracks.reserve(mapTrks -> size());
+    for (
+      SvtxTrackMap::Iter itTrk = mapTrks -> begin();
+      itTrk != mapTrks -> end();
+      ++itTrk
+    ) {
+      if (!(itTrk -> second)) continue;
+      batch.tracks.push_back(itTrk -> second);
+    }
+    batch.Resize(batch.tracks.size());
+
+    // compute dca over a range of tracks
+    auto computeRange = [&batch, &vtx](const size_t start, const size_t stop) {
+      Acts::Vector3 actsVtx = vtx;
+      for (size_t iTrk = start; iTrk < stop; ++iTrk) {
+        SvtxTrack* track     = batch.tracks[iTrk];
+        const auto dcaAndErr = TrackAnalysisUtils::get_dca(track, actsVtx);
+        batch.ids[iTrk]      = track -> get_id();
+        batch.dcaXY[iTrk]    = dcaAndErr.first.first;
+        batch.errXY[iTrk]    = dcaAndErr.first.second;
+        batch.dcaZ[iTrk]     = dcaAndErr.second.first;
+        batch.errZ[iTrk]     = dcaAndErr.second.second;
+      }
+    };
+
+    // if only one thread requested or not worth splitting, run serially
+    const size_t nTrks    = batch.Size();
+    const size_t nWorkers = min(max(nThreads, size_t(1)), nTrks);
+    if (nWorkers <= 1) {
+      computeRange(0, nTrks);
+      return;
+    }
+
+    // otherwise split map into contiguous chunks, one per thread
+    const size_t   chunk = (nTrks + nWorkers - 1) / nWorkers;
+    vector<thread> workers;
+    workers.reserve(nWorkers);
+    for (size_t iWorker = 0; iWorker < nWorkers; ++iWorker) {
+      const size_t start = iWorker * chunk;
+      const size_t stop  = min(start + chunk, nTrks);
+      if (start >= stop) break;
+      workers.emplace_back(computeRange, start, stop);
+    }
+    for (thread& worker : workers) {
+      worker.join();
+    }
+    return;
+
+  }  // end 'ComputeDcaBatch(SvtxTrackMap*, Acts::Vector3&, TrkDcaBatch&, size_t)'
+
+
+
+  Tools::TrkDcaBatch Tools::ComputeDcaBatch(SvtxTrackMap* mapTrks, const Acts::Vector3& vtx, const size_t nThreads) {
+
+    TrkDcaBatch batch;
+    ComputeDcaBatch(mapTrks, vtx, batch, nThreads);
+    return batch;
+
+  }  // end 'ComputeDcaBatch(SvtxTrackMap*, Acts::Vector3&, size_t)'
+
+
+
+  Tools::TrkDcaBatch Tools::ComputeDcaBatch(SvtxTrackMap* mapTrks, const Interfaces::VtxContext& vtxContext, const size_t nThreads) {
+
+    TrkDcaBatch batch;
+    ComputeDcaBatch(mapTrks, vtxContext.GetPrimaryPos(), batch, nThreads);
+    return batch;
+
+  }  // end 'ComputeDcaBatch(SvtxTrackMap*, Interfaces::VtxContext&, size_t)'
+
+
+
+  void Tools::BuildTrkMatchTable(SvtxTrackMap* mapTrks, SvtxClusterEval* clustEval, Types::TrkMatchTable& table) {
+
+    table.Reset();
+    table.Reserve(mapTrks -> size());
+
+    // truth barcodes of each cluster, resolved once per event
+    unordered_map<TrkrDefs::cluskey, vector<int>> truthByClust;
+    truthByClust.reserve(64 * mapTrks -> size());
+
+    // no. of clusters shared with each truth barcode for current track
+    vector<pair<int, int>> nSharedByBarcode;
+
+    // loop over tracks
+    for (
+      SvtxTrackMap::ConstIter itTrk = mapTrks -> begin();
+      itTrk != mapTrks -> end();
+      ++itTrk
+    ) {
+
+      SvtxTrack* track = itTrk -> second;
+      if (!track) continue;
+
+      // tally truth particles over all clusters on the track
+      int nClust = 0;
+      nSharedByBarcode.clear();
+      for (TrackSeed* seed : {track -> get_silicon_seed(), track -> get_tpc_seed()}) {
+        if (!seed) continue;
+        for (
+          auto itClustKey = (seed -> begin_cluster_keys());
+          itClustKey != (seed -> end_cluster_keys());
+          ++itClustKey
+        ) {
+          ++nClust;
+
+          // look up truth associations on first use
+          unordered_map<TrkrDefs::cluskey, vector<int>>::iterator itTruth = truthByClust.find(*itClustKey);
+          if (itTruth == truthByClust.end()) {
+            vector<int> barcodes;
+            for (PHG4Particle* particle : clustEval -> all_truth_particles(*itClustKey)) {
+              if (particle) barcodes.push_back(particle -> get_barcode());
+            }
+            itTruth = truthByClust.emplace(*itClustKey, move(barcodes)).first;
+          }
+
+          // n.b. few particles per track, so a linear search is fine
+          for (const int barcode : itTruth -> second) {
+            vector<pair<int, int>>::iterator itShared = find_if(
+              nSharedByBarcode.begin(),
+              nSharedByBarcode.end(),
+              [barcode](const pair<int, int>& shared) {return shared.first == barcode;}
+            );
+            if (itShared == nSharedByBarcode.end()) {
+              nSharedByBarcode.emplace_back(barcode, 1);
+            } else {
+              ++(itShared -> second);
+            }
+          }
+        }  // end cluster loop
+      }  // end seed loop
+
+      // pick truth particle with most shared clusters
+      int bestBarcode = numeric_limits<int>::max();
+      int bestShared  = 0;
+      for (const pair<int, int>& shared : nSharedByBarcode) {
+        if (shared.second > bestShared) {
+          bestBarcode = shared.first;
+          bestShared  = shared.second;
+        }
+      }
+      table.Add(Types::TrkMatchInfo(track -> get_id(), bestBarcode, bestShared, nClust));
+    }  // end track loop
+    table.Sort();
+    return;
+
+  }  // end 'BuildTrkMatchTable(SvtxTrackMap*, SvtxClusterEval*, Types::TrkMatchTable&)'
+
+
+
+  Types::TrkMatchTable Tools::BuildTrkMatchTable(SvtxTrackMap* mapTrks, SvtxTrackEval* trackEval) {
+
+    Types::TrkMatchTable table;
+    BuildTrkMatchTable(mapTrks, trackEval -> get_cluster_eval(), table);
+    return table;
+
+  }  // end 'BuildTrkMatchTable(SvtxTrackMap*, SvtxTrackEval*)'
+
 }  // end SColdQcdCorrealtorAnalysis namespace
 
 // end ------------------------------------------------------------------------
@@ -12,12 +12,17 @@
 
 // c++ utilities
 #include <array>
+#include <bitset>
 #include <limits>
 #include <string>
+#include <thread>
 #include <vector>
 #include <cassert>
 #include <utility>
+#include <algorithm>
+#include <unordered_map>
 // root utilities
+#include <TF1.h>
 #include <Math/Vector3D.h>
 // phool libraries
 #include <phool/phool.h>
@@ -31,6 +36,7 @@
 #include <trackbase_historic/TrackAnalysisUtils.h>
 // track evaluator utilities
 #include <g4eval/SvtxTrackEval.h>
+#include <g4eval/SvtxClusterEval.h>
 // vertex libraries
 #include <globalvertex/GlobalVertex.h>
 // phenix Geant4 utilities
@@ -38,6 +44,7 @@
 // analysis utilities
 #include "Constants.h"
 #include "Interfaces.h"
+#include "TrkMatchInfo.h"
 
 // make common namespaces implicit
 using namespace std;
@@ -47,17 +54,108 @@ using namespace std;
 namespace SColdQcdCorrelatorAnalysis {
   namespace Tools {
 
+    // track hit summary ------------------------------------------------------
+
+    struct TrkHitSummary {
+
+      // layer bitmasks
+      uint64_t mvtxLayers = 0;
+      uint64_t inttLayers = 0;
+      uint64_t tpcLayers  = 0;
+
+      // cluster counts
+      int nMvtxClust = 0;
+      int nInttClust = 0;
+      int nTpcClust  = 0;
+
+      // methods
+      void Reset();
+      void AddSeed(TrackSeed* seed, const bool addSilicon, const bool addTpc);
+      int  GetNumLayer(const int16_t sys) const;
+      int  GetNumClust(const int16_t sys) const;
+
+    };  // end TrkHitSummary
+
+
+
+    // batch track dca --------------------------------------------------------
+
+    struct TrkDcaBatch {
+
+      // per-track columns
+      vector<SvtxTrack*> tracks;
+      vector<int>        ids;
+      vector<double>     dcaXY;
+      vector<double>     dcaZ;
+      vector<double>     errXY;
+      vector<double>     errZ;
+
+      // methods
+      void                 Clear();
+      void                 Resize(const size_t size);
+      size_t               Size() const {return tracks.size();}
+      pair<double, double> GetDcaPair(const size_t iTrk) const {return make_pair(dcaXY[iTrk], dcaZ[iTrk]);}
+
+    };  // end TrkDcaBatch
+
+
+
+    // compiled sigma-dca model -----------------------------------------------
+
+    struct SigmaDcaModel {
+
+      // parameters of 'Const::SigmaDcaFunc()' and max pt used in fit
+      double par0  = 0.;
+      double par1  = 0.;
+      double par2  = 0.;
+      double ptMax = numeric_limits<double>::max();
+
+      // above max pt used in fit, use value of fit at max pt
+      inline double Eval(const double pt) const {
+        const double ptEval = (pt > ptMax) ? ptMax : pt;
+        return par0 + (par1 / ptEval) + (par2 / (ptEval * ptEval));
+      }
+
+      // tf1 interop
+      void SetParams(const TF1* func);
+      TF1* MakeTF1(const string name, const pair<float, float> range) const;
+
+      // ctors
+      SigmaDcaModel() {}
+      SigmaDcaModel(const vector<float> params, const double ptFitMax);
+      SigmaDcaModel(const TF1* func, const double ptFitMax);
+
+    };  // end SigmaDcaModel
+
+
+
     // track methods ----------------------------------------------------------
 
     int                   GetNumLayer(SvtxTrack* track, const int16_t sys = 0);
     int                   GetNumClust(SvtxTrack* track, const int16_t sys = 0);
     int                   GetMatchID(SvtxTrack* track, SvtxTrackEval* trackEval);
+    int                   GetMatchID(SvtxTrack* track, const Types::TrkMatchTable& table);
     bool                  IsGoodTrackSeed(SvtxTrack* track, const bool requireSiSeeds = true);
     bool                  IsFromPrimaryVtx(SvtxTrack* track, PHCompositeNode* topNode);
+    bool                  IsFromPrimaryVtx(SvtxTrack* track, const Interfaces::VtxContext& vtxContext);
     double                GetTrackDeltaPt(SvtxTrack* track);
     TrackSeed*            GetTrackSeed(SvtxTrack* track, const int16_t sys);
     pair<double, double>  GetTrackDcaPair(SvtxTrack* track, PHCompositeNode* topNode);
+    pair<double, double>  GetTrackDcaPair(SvtxTrack* track, const Interfaces::VtxContext& vtxContext);
+    TrkHitSummary         GetTrackHitSummary(SvtxTrack* track);
     ROOT::Math::XYZVector GetTrackVertex(SvtxTrack* track, PHCompositeNode* topNode);
+    ROOT::Math::XYZVector GetTrackVertex(SvtxTrack* track, const Interfaces::VtxContext& vtxContext);
+
+    // batch track methods
+    void        ApplySigmaDcaCut(const double* pt, const double* dcaXY, const double* dcaZ, uint8_t* mask, const size_t nTrks, const pair<float, float> nSigCut, const pair<SigmaDcaModel, SigmaDcaModel>& sigmaDca);
+    void        ApplySigmaDcaCut(const vector<double>& pt, const vector<double>& dcaXY, const vector<double>& dcaZ, vector<uint8_t>& mask, const pair<float, float> nSigCut, const pair<SigmaDcaModel, SigmaDcaModel>& sigmaDca);
+    void        ComputeDcaBatch(SvtxTrackMap* mapTrks, const Acts::Vector3& vtx, TrkDcaBatch& batch, const size_t nThreads = 1);
+    TrkDcaBatch ComputeDcaBatch(SvtxTrackMap* mapTrks, const Acts::Vector3& vtx, const size_t nThreads = 1);
+    TrkDcaBatch ComputeDcaBatch(SvtxTrackMap* mapTrks, const Interfaces::VtxContext& vtxContext, const size_t nThreads = 1);
+
+    // track-to-truth matching
+    void                 BuildTrkMatchTable(SvtxTrackMap* mapTrks, SvtxClusterEval* clustEval, Types::TrkMatchTable& table);
+    Types::TrkMatchTable BuildTrkMatchTable(SvtxTrackMap* mapTrks, SvtxTrackEval* trackEval);
 
   }  // end Tools namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
@@ -9,14 +9,26 @@
 #ifndef SCORRELATORUTILITIES_TYPES_H
 #define SCORRELATORUTILITIES_TYPES_H
 
+#include "AlignedAllocator.h"
+#include "CaloGrid.h"
 #include "ClustInfo.h"
+#include "ClustInfoSoA.h"
+#include "ConcurrentHist.h"
+#include "CorrHist.h"
 #include "CstInfo.h"
+#include "CstInfoSoA.h"
+#include "CutSet.h"
+#include "EtaPhiIndex.h"
 #include "FlowInfo.h"
 #include "GenInfo.h"
 #include "JetInfo.h"
+#include "MemberLayout.h"
 #include "ParInfo.h"
 #include "RecoInfo.h"
+#include "SparseHist.h"
 #include "TrkInfo.h"
+#include "TrkInfoSoA.h"
+#include "TrkMatchInfo.h"
 
 #endif
 
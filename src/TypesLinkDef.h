@@ -19,6 +19,7 @@
 #include "ParInfo.h"
 #include "RecoInfo.h"
 #include "TrkInfo.h"
+#include "TrkMatchInfo.h"
 
 #ifdef __CINT__
 
@@ -33,6 +34,8 @@
 #pragma link C++ class ParInfo+;
 #pragma link C++ class RecoInfo+;
 #pragma link C++ class TrkInfo+;
+#pragma link C++ class TrkMatchInfo+;
+#pragma link C++ class TrkMatchTable+;
 
 // stl collections of utility classes
 #pragma link C++ class std::vector<ClustInfo>+;
@@ -41,6 +44,7 @@
 #pragma link C++ class std::vector<JetInfo>+;
 #pragma link C++ class std::vector<ParInfo>+;
 #pragma link C++ class std::vector<TrkInfo>+;
+#pragma link C++ class std::vector<TrkMatchInfo>+;
 #pragma link C++ class std::vector<vector<CstInfo> >+;
 #pragma link C++ class std::vector<std::vector<ParInfo> >+;
 #pragma link C++ class std::pair<ParInfo, ParInfo>+;
@@ -73,6 +73,118 @@ namespace SColdQcdCorrelatorAnalysis {
 
   }  // end 'GetRecoVtx(PHCompositeNode*)'
 
+
+
+  // vertex context methods ---------------------------------------------------
+
+  void Interfaces::VtxContext::Reset() {
+
+    primID  = numeric_limits<int>::max();
+    primPos = Acts::Vector3::Zero();
+    primVtx = NULL;
+    mapVtx  = NULL;
+    table.clear();
+    return;
+
+  }  // end 'Reset()'
+
+
+
+  void Interfaces::VtxContext::SetEvent(PHCompositeNode* topNode) {
+
+    // grab vertex map once for the event
+    Reset();
+    mapVtx = Interfaces::GetVertexMap(topNode);
+
+    // primary vertex is the first in the map (cf. 'GetGlobalVertex(...)')
+    primVtx = mapVtx -> begin() -> second;
+    if (!primVtx) {
+      cerr << PHWHERE
+           << "PANIC: no vertex!"
+           << endl;
+      assert(primVtx);
+    }
+    primID  = primVtx -> get_id();
+    primPos = Acts::Vector3(primVtx -> get_x(), primVtx -> get_y(), primVtx -> get_z());
+
+    // index vertices by id in a flat table; ids are small
+    // consecutive integers, so anything unreasonably large
+    // is left to the map
+    const size_t maxIndex = 8 * (mapVtx -> size()) + 64;
+    for (
+      GlobalVertexMap::ConstIter itVtx = mapVtx -> begin();
+      itVtx != mapVtx -> end();
+      ++itVtx
+    ) {
+      const size_t id = itVtx -> first;
+      if (id >= maxIndex) continue;
+      if (id >= table.size()) {
+        table.resize(id + 1, NULL);
+      }
+      table[id] = itVtx -> second;
+    }
+    return;
+
+  }  // end 'SetEvent(PHCompositeNode*)'
+
+
+
+  GlobalVertex* Interfaces::VtxContext::GetVertex(const int id) const {
+
+    // check table first, then fall back to map
+    GlobalVertex* vtx = NULL;
+    if ((id >= 0) && ((size_t) id < table.size())) {
+      vtx = table[id];
+    } else if (mapVtx) {
+      vtx = mapVtx -> get(id);
+    }
+
+    // check if good
+    if (!vtx) {
+      cerr << PHWHERE
+           << "PANIC: no vertex with id " << id << "!"
+           << endl;
+      assert(vtx);
+    }
+    return vtx;
+
+  }  // end 'GetVertex(int)'
+
+
+
+  ROOT::Math::XYZVector Interfaces::VtxContext::GetVertexPos(const int id) const {
+
+    const GlobalVertex* vtx = GetVertex(id);
+    return ROOT::Math::XYZVector(vtx -> get_x(), vtx -> get_y(), vtx -> get_z());
+
+  }  // end 'GetVertexPos(int)'
+
+
+
+  // vertex context ctor/dtor -------------------------------------------------
+
+  Interfaces::VtxContext::VtxContext() {
+
+    /* nothing to do */
+
+  }  // end ctor()
+
+
+
+  Interfaces::VtxContext::~VtxContext() {
+
+    /* nothing to do */
+
+  }  // end dtor()
+
+
+
+  Interfaces::VtxContext::VtxContext(PHCompositeNode* topNode) {
+
+    SetEvent(topNode);
+
+  }  // end ctor(PHCompositeNode*)
+
 }  // end SColdQcdCorrealtorAnalysis namespace
 
 // end ------------------------------------------------------------------------
@@ -11,6 +11,8 @@
 
 // c++ utilities
 #include <array>
+#include <limits>
+#include <vector>
 #include <cassert>
 #include <utility>
 #include <optional>
@@ -25,6 +27,8 @@
 // vertex libraries
 #include <globalvertex/GlobalVertex.h>
 #include <globalvertex/GlobalVertexMap.h>
+// acts libraries
+#include <Acts/Definitions/Algebra.hpp>
 
 // make common namespaces implicit
 using namespace std;
@@ -40,6 +44,44 @@ namespace SColdQcdCorrelatorAnalysis {
     GlobalVertex*         GetGlobalVertex(PHCompositeNode* topNode, optional<int> iVtxToGrab = nullopt);
     ROOT::Math::XYZVector GetRecoVtx(PHCompositeNode* topNode);
 
+
+
+    // event-scoped vertex context --------------------------------------------
+
+    class VtxContext {
+
+      private:
+
+        // data members
+        int                   primID  = numeric_limits<int>::max();
+        Acts::Vector3         primPos = Acts::Vector3::Zero();
+        GlobalVertex*         primVtx = NULL;
+        GlobalVertexMap*      mapVtx  = NULL;
+        vector<GlobalVertex*> table;
+
+      public:
+
+        // getters
+        int                  GetPrimaryID()     const {return primID;}
+        const Acts::Vector3& GetPrimaryPos()    const {return primPos;}
+        GlobalVertex*        GetPrimaryVertex() const {return primVtx;}
+        GlobalVertexMap*     GetVertexMap()     const {return mapVtx;}
+
+        // public methods
+        void                  Reset();
+        void                  SetEvent(PHCompositeNode* topNode);
+        GlobalVertex*         GetVertex(const int id) const;
+        ROOT::Math::XYZVector GetVertexPos(const int id) const;
+
+        // default ctor/dtor
+        VtxContext();
+        ~VtxContext();
+
+        // ctor accepting arguments
+        VtxContext(PHCompositeNode* topNode);
+
+    };  // end VtxContext definition
+
   }  // end Interfaces namespace
 }  // end SColdQcdCorrealtorAnalysis namespace
 